@@ -5,6 +5,77 @@
 #include <string.h>
 #include <stdlib.h>
 #include <limits.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LIST_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define LIST_X86_SIMD 0
+#endif
+
+#define LIST_SORT_INSERTION_THRESHOLD 32 /**< lists up to this size are insertion sorted */
+#define LIST_SORT_RADIX_THRESHOLD 512 /**< lists from this size on are radix sorted */
+#define LIST_PARALLEL_MIN_CHUNK 65536 /**< smallest amount of elements handed to a single thread */
+#define LIST_COUNTING_MAX_RANGE 65536 /**< widest max - min that is counted instead of compared */
+#define LIST_SEQ_HORSPOOL_THRESHOLD 16 /**< sequences from this size on are searched with Boyer-Moore-Horspool */
+#define LIST_SEQ_WORK_FACTOR 4 /**< compares per scanned element a sequence search may spend before switching to KMP */
+#define LIST_INDEX_RESCAN_MAX 32 /**< larger removals inside the list mark the hash index stale instead of checking each value */
+#define LIST_INDEX_SHIFT_MAX 4096 /**< edits inside the list mark a hash index with more slots stale instead of shifting it */
+#define LIST_BLOOM_BITS_PER_VALUE 16 /**< filter bits per value the Bloom filter is sized for, about 0.1% false positives */
+#define LIST_BLOOM_MIN_VALUES 1024 /**< smallest amount of values a Bloom filter is sized for */
+#define LIST_CONTAINS_MANY_SCAN_MAX 4 /**< batches up to this size are searched for one target at a time */
+
+
+typedef struct table_int {
+	int *keys;
+	unsigned int *values;
+	bool *used;
+	unsigned int capacity; /**< always a power of 2 */
+	unsigned int count;
+} table_int;
+
+
+struct list_index_int {
+	table_int table; /**< value -> index of its first occurrence + base */
+	table_int moved; /**< values whose first occurrence was removed, the next one is searched on the next lookup */
+	unsigned int base; /**< added to every stored index, edits at the front move it instead of the stored indexes */
+	bool stale; /**< table has to be rebuilt before it is read */
+};
+
+
+struct list_bloom_int {
+	unsigned long long *blocks; /**< 8 words, one 64 byte cache line, per block */
+	unsigned int block_count;
+	unsigned int capacity; /**< values the filter is sized for */
+	unsigned int added; /**< values added since the last build */
+	unsigned int removed; /**< values removed since the last build, their bits stay set */
+	bool stale; /**< filter has to be rebuilt before it is read */
+};
+
+
+struct list_patterns_int {
+	unsigned int *parent; /**< trie node the node hangs off, node 0 is the root */
+	int *label; /**< value on the edge from the parent */
+	unsigned int *depth;
+	unsigned int *fail; /**< longest proper suffix of the node that is also in the trie */
+	unsigned int *output; /**< first pattern ending at the node, UINT_MAX if none */
+	unsigned int *dict; /**< closest node on the fail chain with an output, UINT_MAX if none */
+	unsigned int node_count;
+	unsigned int node_capacity;
+	unsigned long long *edge_keys; /**< parent << 32 | value */
+	unsigned int *edge_targets; /**< child node, 0 marks an empty slot since the root is nobody's child */
+	unsigned int edge_capacity; /**< always a power of 2 */
+	unsigned int edge_count;
+	unsigned int *pattern_sizes;
+	unsigned int *pattern_next; /**< next pattern ending at the same node, UINT_MAX if none */
+	unsigned int pattern_count;
+	unsigned int pattern_capacity;
+	bool compiled;
+};
+
 
 void swap_int(int *a, int *b)
 {
@@ -22,292 +93,3668 @@ void swap_double(double *a, double *b)
 }
 
 
-list_int *init_list_int(unsigned int init_size)
+bool sorted_run_int(const int *data, unsigned int start, unsigned int end)
 {
-	assert(init_size > 0);
-	list_int *list = malloc(sizeof(list_int));
-	if (list == NULL)
+	for (unsigned int i = start + 1; i < end; i++)
 	{
-		fprintf(stderr, "Error: Memory allocation for list failed.\n");
-		return NULL;
+		if (data[i - 1] > data[i]) return false;
 	}
+	return true;
+}
 
-	list->data = malloc(sizeof(int) * init_size);
 
-	if (list->data == NULL)
-	{
-		free(list);
-		fprintf(stderr, "Error: Memory allocation for list->data failed.\n");
-		return NULL;
-	}
-	list->capacity = init_size;
-	list->size = 0;
-	return list;
+int *list_slot_int(const list_int *list, unsigned int index)
+{
+	// where the value at index lives, values from gap_start on sit behind the gap, a ring wraps around capacity
+	if (list->gap_size != 0 && index >= list->gap_start) return list->data + index + list->gap_size;
+	if (list->head != 0) return list->data + ((list->head + index) & (list->capacity - 1));
+	return list->data + index;
 }
 
 
-list_int *init_list_arr_int(int *arr, unsigned int size)
+bool list_contiguous_int(const list_int *list)
 {
-	assert(size > 0);
-	if (arr == NULL)
+	return list->gap_size == 0 && list->head == 0;
+}
+
+
+unsigned int list_run_int(const list_int *list, unsigned int index, const int **run)
+{
+	// *run points at the value at index, returns how many values from there on are stored back to back
+	// a gap or a wrapped ring splits the values into two runs, readers walk them instead of linearizing
+	if (list->gap_size != 0)
 	{
-		fprintf(stderr, "Error: Attempt to convert NULL arr to list_int");
-		return NULL;
+		if (index < list->gap_start)
+		{
+			*run = list->data + index;
+			return list->gap_start - index;
+		}
+		*run = list->data + index + list->gap_size;
+		return list->size - index;
 	}
 
-	list_int *list = init_list_int(size);
-	if (list == NULL)
+	if (list->head != 0)
 	{
-		fprintf(stderr, "Error: Memory allocation failed.\n");
-		return NULL;
+		const unsigned int slot = (list->head + index) & (list->capacity - 1);
+		*run = list->data + slot;
+		return list->size - index < list->capacity - slot ? list->size - index : list->capacity - slot;
 	}
 
-	list_write_arr_int(list, arr, size, 0);
-	return list;
+	*run = list->data + index;
+	return list->size - index;
 }
 
 
-list_int *list_split_int(list_int *list, int index)
+void list_copy_int(const list_int *list, int *dst)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-
-	if (list->size == 0)
+	// dst[0, list->size) gets the values in order, list->data is left as it is
+	for (unsigned int i = 0; i < list->size;)
 	{
-		fprintf(stderr, "Error: Attempt to split empty list");
-		return NULL;
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		memcpy(dst + i, run, n * sizeof(int));
+		i += n;
 	}
+}
 
-	if (list->size == 1)
+
+void reverse_arr_int(int *data, unsigned int start, unsigned int end)
+{
+	while (end - start > 1)
 	{
-		fprintf(stderr, "Error: Attempt to split list with size of 1");
-		return NULL;
+		swap_int(&data[start++], &data[--end]);
 	}
+}
 
-	if (index == 0)
+
+unsigned int list_grow_capacity_int(const list_int *list, unsigned int needed)
+{
+	// the capacity list->policy grows to for holding needed values, never less than list->policy.min_capacity
+	unsigned int capacity = list->capacity > list->policy.min_capacity ? list->capacity : list->policy.min_capacity;
+	while (capacity < needed)
 	{
-		fprintf(stderr, "Error: Attempt to split at 0");
-		return NULL;
+		const double grown = (double)capacity * list->policy.growth_factor;
+		if (grown >= (double)UINT_MAX) return UINT_MAX;
+		capacity = (unsigned int)grown > capacity ? (unsigned int)grown : capacity + 1;
 	}
+	return capacity;
+}
 
-	if (index >= list->size)
+
+int list_shrink_policy_int(list_int *list)
+{
+	// called after removing values, halves the capacity (in one reallocation) while list->policy allows it
+	if (list->frozen || list->policy.never_shrink) return 0;
+
+	const unsigned int min_capacity = list->policy.min_capacity > 1 ? list->policy.min_capacity : 1;
+	unsigned int capacity = list->capacity;
+	while (list->size < capacity / list->policy.shrink_divisor && capacity / 2 >= min_capacity)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
-		return NULL;
+		capacity /= 2;
 	}
 
-	if (list->readonly)
+	if (capacity != list->capacity && list_resize_int(list, capacity) == -2)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return NULL;
+		fprintf(stderr, "Error: Memory could not be reallocated.\n");
+		return -2;
 	}
+	return 0;
+}
 
-	if (list->static_)
+
+void list_gap_move_int(list_int *list, unsigned int index)
+{
+	// opens the gap (every unused slot) at index, or moves it there, shifting only the values in between
+	if (list->gap_size == 0)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return NULL;
+		list->gap_start = list->size;
+		list->gap_size = list->capacity - list->size;
 	}
 
-	unsigned int midpoint = index;
-
-	if (index == -1)
+	int *data = list->data;
+	if (index < list->gap_start)
 	{
-		midpoint = list->size / 2;
-		if (list->size % 2 != 0)
-		{
-			midpoint++;
-		}
+		memmove(data + index + list->gap_size, data + index, (list->gap_start - index) * sizeof(int));
+	}
+	else if (index > list->gap_start)
+	{
+		memmove(data + list->gap_start, data + list->gap_start + list->gap_size, (index - list->gap_start) * sizeof(int));
 	}
+	list->gap_start = index;
+}
 
-	const unsigned int list_new_size = midpoint;
-	const unsigned int list2_size = list->size - list_new_size;
 
-	list_int *split = init_list_int(list2_size);
+void list_linearize_int(list_int *list)
+{
+	assert(list != NULL);
+	// readonly and static lists are linearized when they are locked and never move again
+	if (list->readonly || list->static_ || list_contiguous_int(list)) return;
 
-	if (split == NULL)
+	if (list->gap_size != 0)
 	{
-		fprintf(stderr, "Error: Failed to allocate memory for new list.\n");
-		return NULL;
+		list_gap_move_int(list, list->size);
+		list->gap_size = 0;
 	}
 
-	for (long i = midpoint; i < list->size; i++)
+	if (list->head != 0)
 	{
-		split->data[split->size++] = list->data[i];
+		if (list->head <= list->capacity - list->size)
+		{
+			memmove(list->data, list->data + list->head, list->size * sizeof(int));
+		}
+		else
+		{
+			// wrapped, rotate the whole ring left by head in place
+			reverse_arr_int(list->data, 0, list->head);
+			reverse_arr_int(list->data, list->head, list->capacity);
+			reverse_arr_int(list->data, 0, list->capacity);
+		}
+		list->head = 0;
 	}
+}
 
-	if (list->frozen)
-	{
-		list->size = list_new_size;
-		return split;
-	}
 
-	list_resize_int(list, list_new_size);
+void list_enable_gap_int(list_int *list)
+{
+	assert(list != NULL);
+	list_linearize_int(list);
+	list->ring_buffer = false;
+	list->gap_buffer = true;
+}
 
-	return split;
 
+void list_disable_gap_int(list_int *list)
+{
+	assert(list != NULL);
+	list_linearize_int(list);
+	list->gap_buffer = false;
 }
 
 
-int list_split_arr_int(list_int *list, int index, int **arr, unsigned int *size)
+void list_enable_ring_int(list_int *list)
 {
 	assert(list != NULL);
-	assert(list->data != NULL);
+	list_linearize_int(list);
+	list->gap_buffer = false;
+	list->ring_buffer = true;
+}
 
-	if (list->size == 0)
+
+void list_disable_ring_int(list_int *list)
+{
+	assert(list != NULL);
+	list_linearize_int(list);
+	list->ring_buffer = false;
+}
+
+
+void list_cache_insert_int(list_int *list, unsigned int index, const int *values, unsigned int count)
+{
+	list_cache_int *cache = list->cache;
+	if (cache == NULL || cache->stale || count == 0) return;
+
+	if (list->size == count)
 	{
-		fprintf(stderr, "Error: Attempt to split empty list.\n");
-		return -1;
+		cache->min = values[0];
+		cache->max = values[0];
+		cache->min_index = index;
+		cache->max_index = index;
+		cache->dirty = false;
 	}
-
-	if (list->size == 1)
+	else if (!cache->dirty)
 	{
-		fprintf(stderr, "Error: Attempt to split list with size of 1.\n");
-		return -1;
+		if (cache->min_index >= index) cache->min_index += count;
+		if (cache->max_index >= index) cache->max_index += count;
 	}
 
-	if (index == 0)
+	for (unsigned int i = 0; i < count; i++)
 	{
-		fprintf(stderr, "Error: Attempt to split at 0.\n");
-		return -1;
+		cache->sum += values[i];
+		if (cache->dirty) continue;
+		if (values[i] < cache->min || (values[i] == cache->min && index + i < cache->min_index))
+		{
+			cache->min = values[i];
+			cache->min_index = index + i;
+		}
+		if (values[i] > cache->max || (values[i] == cache->max && index + i < cache->max_index))
+		{
+			cache->max = values[i];
+			cache->max_index = index + i;
+		}
 	}
+}
 
-	if (index >= list->size)
+
+void list_cache_remove_int(list_int *list, unsigned int index, const int *values, unsigned int count)
+{
+	list_cache_int *cache = list->cache;
+	if (cache == NULL || cache->stale || count == 0) return;
+
+	for (unsigned int i = 0; i < count; i++)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
-		return -1;
+		cache->sum -= values[i];
 	}
 
-	if (arr == NULL)
+	if (cache->dirty) return;
+	if (cache->min_index >= index + count) cache->min_index -= count;
+	else if (cache->min_index >= index) cache->dirty = true;
+	if (cache->max_index >= index + count) cache->max_index -= count;
+	else if (cache->max_index >= index) cache->dirty = true;
+}
+
+
+void list_cache_set_int(list_int *list, unsigned int index, int old_value, int value)
+{
+	list_cache_int *cache = list->cache;
+	if (cache == NULL || cache->stale) return;
+
+	cache->sum += (long long)value - old_value;
+	if (cache->dirty) return;
+
+	if (value < cache->min || (value == cache->min && index < cache->min_index))
 	{
-		fprintf(stderr, "Error: Attempt to assign values to NULL address.\n");
-		return -1;
+		cache->min = value;
+		cache->min_index = index;
 	}
-
-	if (*arr != NULL)
+	else if (index == cache->min_index && value != old_value)
 	{
-		fprintf(stderr, "Error: Attempt to assign values to previously assigned pointer.\n");
-		return -1;
+		cache->dirty = true;
 	}
 
-	if (list->readonly)
+	if (value > cache->max || (value == cache->max && index < cache->max_index))
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		cache->max = value;
+		cache->max_index = index;
+	}
+	else if (index == cache->max_index && value != old_value)
+	{
+		cache->dirty = true;
 	}
+}
 
-	if (list->static_)
+
+unsigned long long bloom_hash_int(int value)
+{
+	unsigned long long h = (unsigned int)value * 0x9E3779B97F4A7C15ull;
+	h ^= h >> 32;
+	h *= 0xD6E8FEB86659FD93ull;
+	h ^= h >> 32;
+	return h;
+}
+
+
+unsigned long long *bloom_block_int(const list_bloom_int *bloom, unsigned long long h)
+{
+	return bloom->blocks + 8 * ((h >> 32) * bloom->block_count >> 32);
+}
+
+
+static const unsigned int bloom_salt[8] = {0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du,
+									0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u};
+
+
+void list_bloom_add_int(list_bloom_int *bloom, int value)
+{
+	// every value sets one bit in each of the 8 words of a single block, so a lookup touches one cache line
+	const unsigned long long h = bloom_hash_int(value);
+	unsigned long long *block = bloom_block_int(bloom, h);
+	for (int i = 0; i < 8; i++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		block[i] |= 1ull << ((unsigned int)h * bloom_salt[i] >> 26);
 	}
+}
 
-	unsigned short midpoint = index;
 
-	if (index == -1)
+int list_bloom_build_int(list_int *list)
+{
+	list_bloom_int *bloom = list->bloom;
+	unsigned int capacity = list->size < LIST_BLOOM_MIN_VALUES ? LIST_BLOOM_MIN_VALUES : list->size;
+	capacity = capacity <= UINT_MAX / 2 ? capacity * 2 : UINT_MAX; // room to grow before the next rebuild
+	const unsigned int block_count = (unsigned int)(((unsigned long long)capacity * LIST_BLOOM_BITS_PER_VALUE + 511) / 512);
+
+	if (block_count != bloom->block_count)
 	{
-		midpoint = list->size / 2;
-		if (list->size % 2 != 0)
+		unsigned long long *blocks = malloc((unsigned long long)block_count * 8 * sizeof(unsigned long long));
+		if (blocks == NULL)
 		{
-			midpoint++;
+			bloom->stale = true;
+			return -2;
 		}
+		free(bloom->blocks);
+		bloom->blocks = blocks;
+		bloom->block_count = block_count;
 	}
+	memset(bloom->blocks, 0, (unsigned long long)block_count * 8 * sizeof(unsigned long long));
 
-	const unsigned short list_new_size = midpoint;
-	*size = list->size - list_new_size;
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		for (unsigned int j = 0; j < n; j++)
+		{
+			list_bloom_add_int(bloom, run[j]);
+		}
+		i += n;
+	}
+	bloom->capacity = capacity;
+	bloom->added = list->size;
+	bloom->removed = 0;
+	bloom->stale = false;
+	return 0;
+}
 
-	*arr = malloc(*size * sizeof(int));
 
-	if (*arr == NULL)
+void list_bloom_insert_int(list_int *list, const int *values, unsigned int count)
+{
+	list_bloom_int *bloom = list->bloom;
+	if (bloom == NULL || bloom->stale) return;
+
+	if (count > bloom->capacity - bloom->added)
 	{
-		fprintf(stderr, "Error: Failed to allocate memory for arr.\n");
-		return -2;
+		// past the size it was built for the false positive rate climbs, resize on the next lookup
+		bloom->stale = true;
+		return;
 	}
 
-	for (unsigned int i = midpoint; i < list->size; i++)
+	for (unsigned int i = 0; i < count; i++)
 	{
-		(*arr)[list->size - i] = list->data[i];
+		list_bloom_add_int(bloom, values[i]);
 	}
+	bloom->added += count;
+}
 
-	if (list->frozen)
+
+void list_bloom_remove_int(list_int *list, unsigned int count)
+{
+	// removed values keep their bits, the filter stays correct and only gets less selective
+	list_bloom_int *bloom = list->bloom;
+	if (bloom == NULL || bloom->stale) return;
+
+	bloom->removed += count;
+	if (bloom->removed > bloom->added / 2) bloom->stale = true;
+}
+
+
+bool list_bloom_maybe_int(list_int *list, int value)
+{
+	// false only if value is definitely not in the list
+	list_bloom_int *bloom = list->bloom;
+	if (bloom == NULL) return true;
+	if (bloom->stale && list_bloom_build_int(list) != 0) return true;
+
+	const unsigned long long h = bloom_hash_int(value);
+	const unsigned long long *block = bloom_block_int(bloom, h);
+	unsigned long long missing = 0;
+	for (int i = 0; i < 8; i++)
 	{
-		list->size = list_new_size;
-		return 0;
+		missing |= ~block[i] & 1ull << ((unsigned int)h * bloom_salt[i] >> 26);
 	}
-	list_resize_int(list, list_new_size);
+	return missing == 0;
+}
 
-	return 0;
+
+void list_index_insert_int(list_int *list, unsigned int index, const int *values, unsigned int count);
+void list_index_remove_int(list_int *list, unsigned int index, const int *values, unsigned int count);
+void list_index_set_int(list_int *list, unsigned int index, int old_value, int value);
+
+
+void list_notify_insert_int(list_int *list, unsigned int index, const int *values, unsigned int count)
+{
+	// called once values[0, count) are in place at [index, index + count) and list->size includes them
+	if (list->sorted && count > 0)
+	{
+		const unsigned int end = index + count < list->size ? index + count + 1 : list->size;
+		for (unsigned int i = index > 0 ? index : 1; i < end && list->sorted; i++)
+		{
+			list->sorted = *list_slot_int(list, i - 1) <= *list_slot_int(list, i);
+		}
+	}
+	list_cache_insert_int(list, index, values, count);
+	list_index_insert_int(list, index, values, count);
+	list_bloom_insert_int(list, values, count);
 }
 
 
-void list_freeze_int(list_int *list)
+void list_notify_remove_int(list_int *list, unsigned int index, const int *values, unsigned int count)
 {
-	assert(list != NULL);
-	list->frozen = true;
+	// called before values[0, count) are removed from [index, index + count), removing keeps the order
+	list_cache_remove_int(list, index, values, count);
+	list_index_remove_int(list, index, values, count);
+	list_bloom_remove_int(list, count);
 }
 
-void list_unfreeze_int(list_int *list)
+
+void list_notify_set_int(list_int *list, unsigned int index, int old_value, int value)
 {
-	assert(list != NULL);
-	list->frozen = false;
+	// called before list->data[index] is overwritten
+	if (list->sorted)
+	{
+		list->sorted = (index == 0 || *list_slot_int(list, index - 1) <= value) &&
+					   (index + 1 >= list->size || value <= *list_slot_int(list, index + 1));
+	}
+	list_cache_set_int(list, index, old_value, value);
+	list_index_set_int(list, index, old_value, value);
+	if (old_value != value)
+	{
+		list_bloom_remove_int(list, 1);
+		list_bloom_insert_int(list, &value, 1);
+	}
 }
 
 
-void list_readonly_int(list_int *list)
+void list_notify_filter_int(list_int *list, unsigned int count)
 {
-	assert(list != NULL);
-	list->readonly = true;
+	// count values were removed from anywhere in the list, the rest kept their order
+	if (count == 0) return;
+	if (list->cache != NULL) list->cache->stale = true;
+	if (list->hash_index != NULL) list->hash_index->stale = true;
+	list_bloom_remove_int(list, count);
 }
 
 
-void list_writable_int(list_int *list)
+void list_notify_reorder_int(list_int *list)
 {
-	assert(list != NULL);
-	list->readonly = false;
+	// same values, different positions
+	list->sorted = list->size <= 1;
+	if (list->cache != NULL) list->cache->dirty = true;
+	if (list->hash_index != NULL) list->hash_index->stale = true;
 }
 
 
-void list_static_int(list_int *list)
+void list_notify_reset_int(list_int *list)
 {
-	assert(list != NULL);
-	list->static_ = true;
+	list->sorted = false;
+	if (list->cache != NULL) list->cache->stale = true;
+	if (list->hash_index != NULL) list->hash_index->stale = true;
+	if (list->bloom != NULL) list->bloom->stale = true;
 }
 
 
-void list_mutable_int(list_int *list)
+unsigned int lower_bound_arr_int(const int *data, unsigned int start, unsigned int end, int target)
 {
-	assert(list != NULL);
-	list->static_ = false;
+	while (start < end)
+	{
+		const unsigned int mid = start + (end - start) / 2;
+		if (data[mid] < target)
+		{
+			start = mid + 1;
+		}
+		else
+		{
+			end = mid;
+		}
+	}
+	return start;
+}
+
+
+unsigned int upper_bound_arr_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	while (start < end)
+	{
+		const unsigned int mid = start + (end - start) / 2;
+		if (data[mid] <= target)
+		{
+			start = mid + 1;
+		}
+		else
+		{
+			end = mid;
+		}
+	}
+	return start;
+}
+
+
+unsigned int list_bound_int(const list_int *list, unsigned int start, int target, bool upper)
+{
+	// lower (or upper) bound of target among the sorted values from start on, list->size if every value is smaller
+	while (start < list->size)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, start, &run);
+		const unsigned int i = upper ? upper_bound_arr_int(run, 0, n, target) : lower_bound_arr_int(run, 0, n, target);
+		if (i < n) return start + i;
+		start += n;
+	}
+	return list->size;
+}
+
+
+list_int *init_list_int(unsigned int init_size)
+{
+	assert(init_size > 0);
+	list_int *list = malloc(sizeof(list_int));
+	if (list == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation for list failed.\n");
+		return NULL;
+	}
+
+	list->data = malloc(sizeof(int) * init_size);
+
+	if (list->data == NULL)
+	{
+		free(list);
+		fprintf(stderr, "Error: Memory allocation for list->data failed.\n");
+		return NULL;
+	}
+	list->frozen = false;
+	list->readonly = false;
+	list->static_ = false;
+	list->capacity = init_size;
+	list->size = 0;
+	list->sorted = true;
+	list->cache = NULL;
+	list->hash_index = NULL;
+	list->bloom = NULL;
+	list->gap_buffer = false;
+	list->gap_start = 0;
+	list->gap_size = 0;
+	list->ring_buffer = false;
+	list->head = 0;
+	list->policy = (list_policy_int){2.0, 1, 4, false};
+	return list;
+}
+
+
+list_int *init_list_arr_int(int *arr, unsigned int size)
+{
+	assert(size > 0);
+	if (arr == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to convert NULL arr to list_int");
+		return NULL;
+	}
+
+	list_int *list = init_list_int(size);
+	if (list == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation failed.\n");
+		return NULL;
+	}
+
+	list_write_arr_int(list, arr, size, 0);
+	return list;
+}
+
+
+list_int *list_split_int(list_int *list, int index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to split empty list");
+		return NULL;
+	}
+
+	if (list->size == 1)
+	{
+		fprintf(stderr, "Error: Attempt to split list with size of 1");
+		return NULL;
+	}
+
+	if (index == 0)
+	{
+		fprintf(stderr, "Error: Attempt to split at 0");
+		return NULL;
+	}
+
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return NULL;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return NULL;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return NULL;
+	}
+
+	unsigned int midpoint = index;
+
+	if (index == -1)
+	{
+		midpoint = list->size / 2;
+		if (list->size % 2 != 0)
+		{
+			midpoint++;
+		}
+	}
+
+	const unsigned int list_new_size = midpoint;
+	const unsigned int list2_size = list->size - list_new_size;
+
+	list_int *split = init_list_int(list2_size);
+
+	if (split == NULL)
+	{
+		fprintf(stderr, "Error: Failed to allocate memory for new list.\n");
+		return NULL;
+	}
+
+	for (long i = midpoint; i < list->size; i++)
+	{
+		split->data[split->size++] = list->data[i];
+	}
+	split->sorted = list->sorted;
+
+	list_notify_remove_int(list, midpoint, list->data + midpoint, list->size - midpoint);
+	list->size = list_new_size;
+	list_shrink_policy_int(list);
+
+	return split;
+
+}
+
+
+int list_split_arr_int(list_int *list, int index, int **arr, unsigned int *size)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to split empty list.\n");
+		return -1;
+	}
+
+	if (list->size == 1)
+	{
+		fprintf(stderr, "Error: Attempt to split list with size of 1.\n");
+		return -1;
+	}
+
+	if (index == 0)
+	{
+		fprintf(stderr, "Error: Attempt to split at 0.\n");
+		return -1;
+	}
+
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (arr == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to assign values to NULL address.\n");
+		return -1;
+	}
+
+	if (*arr != NULL)
+	{
+		fprintf(stderr, "Error: Attempt to assign values to previously assigned pointer.\n");
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	unsigned short midpoint = index;
+
+	if (index == -1)
+	{
+		midpoint = list->size / 2;
+		if (list->size % 2 != 0)
+		{
+			midpoint++;
+		}
+	}
+
+	const unsigned short list_new_size = midpoint;
+	*size = list->size - list_new_size;
+
+	*arr = malloc(*size * sizeof(int));
+
+	if (*arr == NULL)
+	{
+		fprintf(stderr, "Error: Failed to allocate memory for arr.\n");
+		return -2;
+	}
+
+	for (unsigned int i = midpoint; i < list->size; i++)
+	{
+		(*arr)[list->size - i] = list->data[i];
+	}
+
+	list_notify_remove_int(list, midpoint, list->data + midpoint, list->size - midpoint);
+	list->size = list_new_size;
+	list_shrink_policy_int(list);
+
+	return 0;
+}
+
+
+void list_freeze_int(list_int *list)
+{
+	assert(list != NULL);
+	list->frozen = true;
+}
+
+void list_unfreeze_int(list_int *list)
+{
+	assert(list != NULL);
+	list->frozen = false;
+}
+
+
+void list_readonly_int(list_int *list)
+{
+	assert(list != NULL);
+	list_linearize_int(list);
+	list->readonly = true;
+}
+
+
+void list_writable_int(list_int *list)
+{
+	assert(list != NULL);
+	list->readonly = false;
+}
+
+
+void list_static_int(list_int *list)
+{
+	assert(list != NULL);
+	list_linearize_int(list);
+	list->static_ = true;
+}
+
+
+void list_mutable_int(list_int *list)
+{
+	assert(list != NULL);
+	list->static_ = false;
+}
+
+
+void list_mark_unsorted_int(list_int *list)
+{
+	assert(list != NULL);
+	list->sorted = false;
+}
+
+
+int list_enable_cache_int(list_int *list)
+{
+	assert(list != NULL);
+	if (list->cache != NULL) return 0;
+
+	list->cache = malloc(sizeof(list_cache_int));
+	if (list->cache == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation for list->cache failed.\n");
+		return -2;
+	}
+	list->cache->stale = true;
+	list->cache->dirty = true;
+	return 0;
+}
+
+
+void list_disable_cache_int(list_int *list)
+{
+	assert(list != NULL);
+	free(list->cache);
+	list->cache = NULL;
+}
+
+
+int list_enable_bloom_int(list_int *list)
+{
+	assert(list != NULL);
+	if (list->bloom != NULL) return 0;
+
+	list->bloom = calloc(1, sizeof(list_bloom_int));
+	if (list->bloom == NULL || list_bloom_build_int(list) != 0)
+	{
+		free(list->bloom);
+		list->bloom = NULL;
+		fprintf(stderr, "Error: Memory allocation for list->bloom failed.\n");
+		return -2;
+	}
+	return 0;
+}
+
+
+void list_disable_bloom_int(list_int *list)
+{
+	assert(list != NULL);
+	if (list->bloom == NULL) return;
+
+	free(list->bloom->blocks);
+	free(list->bloom);
+	list->bloom = NULL;
+}
+
+
+int list_destroy_int(list_int **list)
+{
+	if (list == NULL) return 0;
+	if (*list == NULL) return 0;
+
+	if ((*list)->static_)
+	{
+		fprintf(stderr, "Error: Attempt to destroy a static list.\n");
+		return -3;
+	}
+
+	list_disable_cache_int(*list);
+	list_disable_index_int(*list);
+	list_disable_bloom_int(*list);
+	free((*list)->data);
+	(*list)->data = NULL;
+	free(*list);
+	*list = NULL;
+	return 0;
+}
+
+
+int list_clear_int(list_int *list)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->frozen)
+	{
+		list_notify_reset_int(list);
+		list->size = 0;
+		list->sorted = true;
+		return 0;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	list_notify_reset_int(list);
+	list->size = 0;
+	list->sorted = true;
+	if (list->policy.never_shrink || list->capacity <= list->policy.min_capacity) return 0;
+	return list_resize_int(list, list->policy.min_capacity) == 0 ? 0 : -2;
+}
+
+
+int list_reverse_int(list_int *list)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	for (unsigned int i = 0; i < list->size / 2; i++)
+	{
+		swap_int(&list->data[i], &list->data[list->size - i - 1]);
+	}
+	list_notify_reorder_int(list);
+	return 0;
+}
+
+
+void merge_int(int *arr, int left, int mid, int right)
+{
+	const int n1 = mid - left + 1;
+	const int n2 = right - mid;
+
+	int L[n1];
+	int R[n2];
+
+	for (unsigned int i = 0; i < n1; i++)
+	{
+		L[i] = arr[left + i];
+	}
+	for (unsigned int j = 0; j < n2; j++)
+	{
+		R[j] = arr[mid + 1 + j];
+	}
+
+	int i = 0, j = 0, k = left;
+	while (i < n1 && j < n2)
+	{
+		if (L[i] <= R[j])
+		{
+			arr[k] = L[i];
+			i++;
+		} else
+		{
+			arr[k] = R[j];
+			j++;
+		}
+		k++;
+	}
+
+	while (i < n1)
+	{
+		arr[k] = L[i];
+		i++;
+		k++;
+	}
+
+	while (j < n2)
+	{
+		arr[k] = R[j];
+		j++;
+		k++;
+	}
+}
+
+
+void merge_sort_int(int *arr, int left, int right) // NOLINT(*-no-recursion)
+{
+	if (left < right)
+	{
+		const int mid = left + (right - left) / 2;
+
+		merge_sort_int(arr, left, mid);
+		merge_sort_int(arr, mid + 1, right);
+
+		merge_int(arr, left, mid, right);
+	}
+}
+
+
+#ifdef __SIZEOF_INT128__
+typedef __int128 wide_int; /**< sum accumulator that cannot overflow for any list_int */
+#else
+typedef long long wide_int;
+#endif
+
+
+// the minmax and sum kernels live next to list_minmax_int() and list_sum_int()
+void minmax_scalar_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index);
+wide_int sum_scalar_int(const int *data, unsigned int size);
+#if LIST_X86_SIMD
+__attribute__((target("sse4.1")))
+void minmax_sse41_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index);
+__attribute__((target("avx2")))
+void minmax_avx2_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index);
+__attribute__((target("sse4.1")))
+wide_int sum_sse41_int(const int *data, unsigned int size);
+__attribute__((target("avx2")))
+wide_int sum_avx2_int(const int *data, unsigned int size);
+#endif
+
+
+unsigned int find_scalar_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	for (unsigned int i = start; i < end; i++)
+	{
+		if (data[i] == target) return i;
+	}
+	return end;
+}
+
+
+unsigned int seq_filter_scalar_int(const int *data, unsigned int start, unsigned int last, int first, int final,
+									unsigned int span)
+{
+	for (unsigned int i = start; i < last; i++)
+	{
+		if (data[i] == first && data[i + span] == final) return i;
+	}
+	return last;
+}
+
+
+unsigned int count_scalar_int(const int *data, unsigned int size, int target)
+{
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < size; i++)
+	{
+		count += data[i] == target;
+	}
+	return count;
+}
+
+
+unsigned int find_all_scalar_int(const int *data, unsigned int start, unsigned int end, int target, int *out,
+								 unsigned int *count, unsigned int limit)
+{
+	for (unsigned int i = start; i < end; i++)
+	{
+		if (data[i] != target) continue;
+		if (*count == limit) return i;
+		out[(*count)++] = (int)i;
+	}
+	return end;
+}
+
+
+unsigned int compact_scalar_int(int *data, unsigned int size, int target)
+{
+	// keeps every value other than target in order, returns how many were kept
+	unsigned int kept = 0;
+	for (unsigned int i = 0; i < size; i++)
+	{
+		const int value = data[i];
+		data[kept] = value;
+		kept += value != target;
+	}
+	return kept;
+}
+
+
+#if LIST_X86_SIMD
+__attribute__((target("sse2")))
+unsigned int find_sse2_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	const __m128i needle = _mm_set1_epi32(target);
+	unsigned int i = start;
+	for (; i + 4 <= end; i += 4)
+	{
+		const __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+		const int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(value, needle)));
+		if (mask != 0) return i + __builtin_ctz(mask);
+	}
+	return find_scalar_int(data, i, end, target);
+}
+
+
+__attribute__((target("avx2")))
+unsigned int find_avx2_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	const __m256i needle = _mm256_set1_epi32(target);
+	unsigned int i = start;
+
+	// 32 values per iteration, only a hit pays for finding which of the 4 vectors matched
+	for (; i + 32 <= end; i += 32)
+	{
+		const __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+		const __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), needle);
+		const __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 16)), needle);
+		const __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 24)), needle);
+		const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+		if (_mm256_testz_si256(any, any)) continue;
+
+		const unsigned long long mask =
+			(unsigned long long)(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(a)) |
+			(unsigned long long)(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(b)) << 8 |
+			(unsigned long long)(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c)) << 16 |
+			(unsigned long long)(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(d)) << 24;
+		return i + __builtin_ctzll(mask);
+	}
+
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256i value = _mm256_loadu_si256((const __m256i *)(data + i));
+		const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(value, needle)));
+		if (mask != 0) return i + __builtin_ctz(mask);
+	}
+	return find_scalar_int(data, i, end, target);
+}
+
+
+__attribute__((target("avx512f")))
+unsigned int find_avx512_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	const __m512i needle = _mm512_set1_epi32(target);
+	unsigned int i = start;
+	for (; i + 16 <= end; i += 16)
+	{
+		const __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+		if (mask != 0) return i + __builtin_ctz(mask);
+	}
+
+	if (i < end)
+	{
+		// masked load, lanes past the end are never read
+		const __mmask16 tail = (__mmask16)((1u << (end - i)) - 1);
+		const __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, data + i), needle);
+		if (mask != 0) return i + __builtin_ctz(mask);
+	}
+	return end;
+}
+
+
+__attribute__((target("avx2")))
+unsigned int seq_filter_avx2_int(const int *data, unsigned int start, unsigned int last, int first, int final,
+								 unsigned int span)
+{
+	// tests 8 candidate starts at once against both ends of the sequence
+	const __m256i head = _mm256_set1_epi32(first);
+	const __m256i tail = _mm256_set1_epi32(final);
+	unsigned int i = start;
+	for (; i + 8 <= last; i += 8)
+	{
+		const __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), head);
+		const __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + span)), tail);
+		const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(a, b)));
+		if (mask != 0) return i + __builtin_ctz(mask);
+	}
+	return seq_filter_scalar_int(data, i, last, first, final, span);
+}
+
+
+__attribute__((target("avx2")))
+unsigned int count_avx2_int(const int *data, unsigned int size, int target)
+{
+	// a match compares to -1, so subtracting the compare counts it, lanes stay below size / 8
+	const __m256i needle = _mm256_set1_epi32(target);
+	__m256i acc0 = _mm256_setzero_si256();
+	__m256i acc1 = _mm256_setzero_si256();
+	unsigned int i = 0;
+	for (; i + 16 <= size; i += 16)
+	{
+		acc0 = _mm256_sub_epi32(acc0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle));
+		acc1 = _mm256_sub_epi32(acc1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), needle));
+	}
+
+	unsigned int lanes[8];
+	_mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi32(acc0, acc1));
+	unsigned int count = 0;
+	for (int lane = 0; lane < 8; lane++)
+	{
+		count += lanes[lane];
+	}
+	return count + count_scalar_int(data + i, size - i, target);
+}
+
+
+__attribute__((target("avx2")))
+unsigned int find_all_avx2_int(const int *data, unsigned int start, unsigned int end, int target, int *out,
+							   unsigned int *count, unsigned int limit)
+{
+	const __m256i needle = _mm256_set1_epi32(target);
+	unsigned int i = start;
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256i value = _mm256_loadu_si256((const __m256i *)(data + i));
+		unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(value, needle)));
+		while (mask != 0)
+		{
+			if (*count == limit) return i + __builtin_ctz(mask);
+			out[(*count)++] = (int)(i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+	return find_all_scalar_int(data, i, end, target, out, count, limit);
+}
+
+
+static unsigned int compact_lut[256][8]; /**< lanes to gather for every keep mask, filled with the kernel table */
+
+
+void compact_lut_init_int(void)
+{
+	for (unsigned int mask = 0; mask < 256; mask++)
+	{
+		unsigned int lane = 0;
+		for (unsigned int bit = 0; bit < 8; bit++)
+		{
+			if (mask & 1u << bit) compact_lut[mask][lane++] = bit;
+		}
+		while (lane < 8) compact_lut[mask][lane++] = 0;
+	}
+}
+
+
+__attribute__((target("avx2,popcnt")))
+unsigned int compact_avx2_int(int *data, unsigned int size, int target)
+{
+	// stream compaction, kept lanes are packed to the front and stored at the write position,
+	// which never passes the read position, so the 8 lane store only overwrites values already loaded
+	const __m256i needle = _mm256_set1_epi32(target);
+	unsigned int kept = 0;
+	unsigned int i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		const __m256i value = _mm256_loadu_si256((const __m256i *)(data + i));
+		const unsigned int keep =
+			~(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(value, needle))) & 0xFF;
+		const __m256i lanes = _mm256_loadu_si256((const __m256i *)compact_lut[keep]);
+		_mm256_storeu_si256((__m256i *)(data + kept), _mm256_permutevar8x32_epi32(value, lanes));
+		kept += __builtin_popcount(keep);
+	}
+	for (; i < size; i++)
+	{
+		const int value = data[i];
+		data[kept] = value;
+		kept += value != target;
+	}
+	return kept;
+}
+#endif
+
+
+typedef struct list_kernels_int {
+	void (*minmax)(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index);
+	wide_int (*sum)(const int *data, unsigned int size);
+	unsigned int (*find)(const int *data, unsigned int start, unsigned int end, int target);
+	unsigned int (*seq_filter)(const int *data, unsigned int start, unsigned int last, int first, int final,
+							   unsigned int span);
+	unsigned int (*count)(const int *data, unsigned int size, int target);
+	unsigned int (*find_all)(const int *data, unsigned int start, unsigned int end, int target, int *out,
+							 unsigned int *count, unsigned int limit);
+	unsigned int (*compact)(int *data, unsigned int size, int target);
+} list_kernels_int;
+
+
+static list_kernels_int list_kernels = {minmax_scalar_int, sum_scalar_int, find_scalar_int, seq_filter_scalar_int,
+								 count_scalar_int, find_all_scalar_int, compact_scalar_int}; /**< widest kernels the cpu supports */
+
+
+#if LIST_X86_SIMD
+__attribute__((constructor))
+void list_select_kernels_int(void)
+{
+	// runs once at load time, so one binary uses the best instructions of whatever cpu it lands on
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("sse2"))
+	{
+		list_kernels.find = find_sse2_int;
+	}
+	if (__builtin_cpu_supports("sse4.1"))
+	{
+		list_kernels.minmax = minmax_sse41_int;
+		list_kernels.sum = sum_sse41_int;
+	}
+	if (__builtin_cpu_supports("avx2"))
+	{
+		list_kernels.minmax = minmax_avx2_int;
+		list_kernels.sum = sum_avx2_int;
+		list_kernels.find = find_avx2_int;
+		list_kernels.seq_filter = seq_filter_avx2_int;
+		list_kernels.count = count_avx2_int;
+		list_kernels.find_all = find_all_avx2_int;
+		compact_lut_init_int();
+		list_kernels.compact = compact_avx2_int;
+	}
+	if (__builtin_cpu_supports("avx512f"))
+	{
+		list_kernels.find = find_avx512_int;
+	}
+}
+#endif
+
+
+void minmax_arr_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index)
+{
+	list_kernels.minmax(data, size, min_index, max_index);
+}
+
+
+wide_int sum_arr_int(const int *data, unsigned int size)
+{
+	return list_kernels.sum(data, size);
+}
+
+
+unsigned int find_arr_int(const int *data, unsigned int start, unsigned int end, int target)
+{
+	// index of the first target in [start, end), or end if there is none
+	return list_kernels.find(data, start, end, target);
+}
+
+
+unsigned int list_find_int(const list_int *list, unsigned int start, int target)
+{
+	// index of the first target from start on, or list->size if there is none
+	while (start < list->size)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, start, &run);
+		const unsigned int i = find_arr_int(run, 0, n, target);
+		if (i < n) return start + i;
+		start += n;
+	}
+	return list->size;
+}
+
+
+void insertion_sort_int(int *arr, unsigned int size)
+{
+	for (unsigned int i = 1; i < size; i++)
+	{
+		const int value = arr[i];
+		unsigned int j = i;
+		while (j > 0 && arr[j - 1] > value)
+		{
+			arr[j] = arr[j - 1];
+			j--;
+		}
+		arr[j] = value;
+	}
+}
+
+
+void radix_sort_int(int *arr, unsigned int size, int *scratch)
+{
+	// 4 passes of 8 bit digits, the sign bit is flipped so negative values sort before positive ones
+	unsigned int counts[4][256] = {0};
+
+	for (unsigned int i = 0; i < size; i++)
+	{
+		const unsigned int key = (unsigned int)arr[i] ^ 0x80000000u;
+		counts[0][key & 0xFF]++;
+		counts[1][key >> 8 & 0xFF]++;
+		counts[2][key >> 16 & 0xFF]++;
+		counts[3][key >> 24]++;
+	}
+
+	int *src = arr;
+	int *dst = scratch;
+	for (unsigned int pass = 0; pass < 4; pass++)
+	{
+		const unsigned int shift = pass * 8;
+		unsigned int *count = counts[pass];
+
+		// every value shares this digit, the pass would not move anything
+		if (count[((unsigned int)src[0] ^ 0x80000000u) >> shift & 0xFF] == size) continue;
+
+		unsigned int offset = 0;
+		for (unsigned int d = 0; d < 256; d++)
+		{
+			const unsigned int temp = count[d];
+			count[d] = offset;
+			offset += temp;
+		}
+
+		for (unsigned int i = 0; i < size; i++)
+		{
+			const unsigned int key = (unsigned int)src[i] ^ 0x80000000u;
+			dst[count[key >> shift & 0xFF]++] = src[i];
+		}
+
+		int *temp = src;
+		src = dst;
+		dst = temp;
+	}
+
+	if (src != arr)
+	{
+		memcpy(arr, src, size * sizeof(int));
+	}
+}
+
+
+void histogram_arr_int(const int *data, unsigned int size, int lo, unsigned int range, unsigned int *counts)
+{
+	// adds to the range entries of counts, values outside of [lo, lo + range) are skipped
+	if (range <= 256)
+	{
+		// narrow ranges hammer the same few counters, spreading them over 4 tables keeps the increments independent
+		unsigned int partial[4][256] = {0};
+		unsigned int i = 0;
+		for (; i + 4 <= size; i += 4)
+		{
+			for (unsigned int j = 0; j < 4; j++)
+			{
+				const unsigned int offset = (unsigned int)data[i + j] - (unsigned int)lo;
+				if (offset < range) partial[j][offset]++;
+			}
+		}
+		for (; i < size; i++)
+		{
+			const unsigned int offset = (unsigned int)data[i] - (unsigned int)lo;
+			if (offset < range) partial[0][offset]++;
+		}
+		for (unsigned int d = 0; d < range; d++)
+		{
+			counts[d] += partial[0][d] + partial[1][d] + partial[2][d] + partial[3][d];
+		}
+		return;
+	}
+
+	for (unsigned int i = 0; i < size; i++)
+	{
+		const unsigned int offset = (unsigned int)data[i] - (unsigned int)lo;
+		if (offset < range) counts[offset]++;
+	}
+}
+
+
+bool narrow_range_arr_int(const int *data, unsigned int size, int *min, int *max)
+{
+	// a strided sample rejects wide data before paying for the full min/max sweep
+	const unsigned int stride = size / 64 > 0 ? size / 64 : 1;
+	int sample_min = data[0], sample_max = data[0];
+	for (unsigned int i = stride; i < size; i += stride)
+	{
+		if (data[i] < sample_min) sample_min = data[i];
+		if (data[i] > sample_max) sample_max = data[i];
+	}
+	if ((unsigned int)sample_max - (unsigned int)sample_min >= LIST_COUNTING_MAX_RANGE) return false;
+
+	unsigned int min_i, max_i;
+	minmax_arr_int(data, size, &min_i, &max_i);
+	*min = data[min_i];
+	*max = data[max_i];
+
+	const unsigned int range = (unsigned int)*max - (unsigned int)*min;
+	return range < LIST_COUNTING_MAX_RANGE && range < size;
+}
+
+
+bool counting_sort_arr_int(int *arr, unsigned int size)
+{
+	int min, max;
+	if (!narrow_range_arr_int(arr, size, &min, &max)) return false;
+
+	const unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+	unsigned int *counts = malloc(range * sizeof(unsigned int));
+	if (counts == NULL) return false;
+
+	memset(counts, 0, range * sizeof(unsigned int));
+	histogram_arr_int(arr, size, min, range, counts);
+
+	unsigned int k = 0;
+	for (unsigned int d = 0; d < range; d++)
+	{
+		const int value = (int)((unsigned int)min + d);
+		for (unsigned int c = counts[d]; c > 0; c--)
+		{
+			arr[k++] = value;
+		}
+	}
+	free(counts);
+	return true;
+}
+
+
+int sort_arr_int(int *arr, unsigned int size)
+{
+	if (size <= LIST_SORT_INSERTION_THRESHOLD)
+	{
+		insertion_sort_int(arr, size);
+		return 0;
+	}
+
+	if (size < LIST_SORT_RADIX_THRESHOLD)
+	{
+		merge_sort_int(arr, 0, (int)size - 1);
+		return 0;
+	}
+
+	if (counting_sort_arr_int(arr, size))
+	{
+		return 0;
+	}
+
+	int *scratch = malloc(size * sizeof(int));
+	if (scratch == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation for sort buffer failed.\n");
+		return -2;
+	}
+	radix_sort_int(arr, size, scratch);
+	free(scratch);
+	return 0;
+}
+
+
+int list_histogram_int(list_int *list, int lo, int hi, unsigned int *counts)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (counts == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to assign values to NULL address.\n");
+		return -1;
+	}
+
+	if (lo > hi)
+	{
+		fprintf(stderr, "Error: lo is greater than hi.\n");
+		return -1;
+	}
+
+	if ((unsigned int)hi - (unsigned int)lo == UINT_MAX)
+	{
+		fprintf(stderr, "Error: Histogram range cannot exceed %u values.\n", UINT_MAX);
+		return -1;
+	}
+
+	const unsigned int range = (unsigned int)hi - (unsigned int)lo + 1;
+	memset(counts, 0, range * sizeof(unsigned int));
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		histogram_arr_int(run, n, lo, range, counts);
+		i += n;
+	}
+	return 0;
+}
+
+
+int list_sort_int(list_int *list)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (list->sorted)
+	{
+		return 0;
+	}
+
+	list_notify_reorder_int(list);
+	const int state = sort_arr_int(list->data, list->size);
+	if (state == 0)
+	{
+		list->sorted = true;
+	}
+	return state;
+}
+
+
+typedef struct sort_task_int {
+	int *arr;
+	unsigned int size;
+	int *scratch;
+} sort_task_int;
+
+
+typedef struct merge_task_int {
+	const int *a;
+	unsigned int a_size;
+	const int *b;
+	unsigned int b_size;
+	int *out;
+} merge_task_int;
+
+
+unsigned int list_thread_count_int(unsigned int nthreads, unsigned int size)
+{
+	if (nthreads == 0)
+	{
+		const long online = sysconf(_SC_NPROCESSORS_ONLN);
+		nthreads = online > 0 ? (unsigned int)online : 1;
+	}
+
+	const unsigned int max_threads = size / LIST_PARALLEL_MIN_CHUNK;
+	if (nthreads > max_threads) nthreads = max_threads;
+	return nthreads == 0 ? 1 : nthreads;
+}
+
+
+void run_parallel_int(void *(*routine)(void *), void *tasks, size_t task_size, unsigned int count)
+{
+	pthread_t threads[count];
+	bool started[count];
+
+	for (unsigned int i = 1; i < count; i++)
+	{
+		started[i] = pthread_create(&threads[i], NULL, routine, (char *)tasks + i * task_size) == 0;
+		if (!started[i])
+		{
+			// out of threads, do the work on the calling thread instead
+			routine((char *)tasks + i * task_size);
+		}
+	}
+
+	routine(tasks);
+
+	for (unsigned int i = 1; i < count; i++)
+	{
+		if (started[i]) pthread_join(threads[i], NULL);
+	}
+}
+
+
+void *sort_task_run_int(void *arg)
+{
+	const sort_task_int *task = arg;
+	radix_sort_int(task->arr, task->size, task->scratch);
+	return NULL;
+}
+
+
+unsigned int merge_path_int(const int *a, unsigned int a_size, const int *b, unsigned int b_size, unsigned long diag)
+{
+	// finds how many values of a are in the first diag values of the merged output, a wins ties
+	unsigned int low = diag > b_size ? (unsigned int)(diag - b_size) : 0;
+	unsigned int high = diag < a_size ? (unsigned int)diag : a_size;
+
+	while (low < high)
+	{
+		const unsigned int mid = low + (high - low) / 2;
+		if (a[mid] <= b[diag - mid - 1])
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	return low;
+}
+
+
+void *merge_task_run_int(void *arg)
+{
+	const merge_task_int *task = arg;
+	unsigned int i = 0, j = 0, k = 0;
+
+	while (i < task->a_size && j < task->b_size)
+	{
+		if (task->a[i] <= task->b[j])
+		{
+			task->out[k++] = task->a[i++];
+		}
+		else
+		{
+			task->out[k++] = task->b[j++];
+		}
+	}
+
+	memcpy(task->out + k, task->a + i, (task->a_size - i) * sizeof(int));
+	k += task->a_size - i;
+	if (j < task->b_size)
+	{
+		memcpy(task->out + k, task->b + j, (task->b_size - j) * sizeof(int));
+	}
+	return NULL;
+}
+
+
+int list_sort_parallel_int(list_int *list, unsigned int nthreads)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	nthreads = list_thread_count_int(nthreads, list->size);
+	if (nthreads == 1 || list->sorted)
+	{
+		return list_sort_int(list);
+	}
+
+	const unsigned int size = list->size;
+	int *scratch = malloc(size * sizeof(int));
+	unsigned int *bounds = malloc((nthreads + 1) * sizeof(unsigned int));
+	merge_task_int *merges = malloc((nthreads + 1) * sizeof(merge_task_int));
+	sort_task_int *sorts = malloc(nthreads * sizeof(sort_task_int));
+
+	if (scratch == NULL || bounds == NULL || merges == NULL || sorts == NULL)
+	{
+		free(scratch);
+		free(bounds);
+		free(merges);
+		free(sorts);
+		fprintf(stderr, "Error: Memory allocation for parallel sort failed.\n");
+		return -2;
+	}
+
+	for (unsigned int i = 0; i <= nthreads; i++)
+	{
+		bounds[i] = (unsigned int)((unsigned long)size * i / nthreads);
+	}
+
+	for (unsigned int i = 0; i < nthreads; i++)
+	{
+		sorts[i].arr = list->data + bounds[i];
+		sorts[i].size = bounds[i + 1] - bounds[i];
+		sorts[i].scratch = scratch + bounds[i];
+	}
+	run_parallel_int(sort_task_run_int, sorts, sizeof(sort_task_int), nthreads);
+
+	// merge pairs of sorted runs until one is left, every merge is split along its merge path
+	// so that all threads stay busy even once only a couple of runs remain
+	int *src = list->data;
+	int *dst = scratch;
+	unsigned int runs = nthreads;
+	while (runs > 1)
+	{
+		const unsigned int pairs = runs / 2;
+		const unsigned int parts = nthreads / pairs > 0 ? nthreads / pairs : 1;
+		unsigned int count = 0;
+
+		for (unsigned int p = 0; p < pairs; p++)
+		{
+			const unsigned int start = bounds[2 * p];
+			const int *a = src + start;
+			const unsigned int a_size = bounds[2 * p + 1] - start;
+			const int *b = src + bounds[2 * p + 1];
+			const unsigned int b_size = bounds[2 * p + 2] - bounds[2 * p + 1];
+			const unsigned long total = (unsigned long)a_size + b_size;
+
+			unsigned int prev_i = 0;
+			unsigned long prev_diag = 0;
+			for (unsigned int part = 1; part <= parts; part++)
+			{
+				const unsigned long diag = total * part / parts;
+				const unsigned int i = merge_path_int(a, a_size, b, b_size, diag);
+				const unsigned int prev_j = (unsigned int)(prev_diag - prev_i);
+
+				merges[count].a = a + prev_i;
+				merges[count].a_size = i - prev_i;
+				merges[count].b = b + prev_j;
+				merges[count].b_size = (unsigned int)(diag - i) - prev_j;
+				merges[count].out = dst + start + prev_diag;
+				count++;
+
+				prev_i = i;
+				prev_diag = diag;
+			}
+		}
+
+		if (runs % 2 != 0)
+		{
+			// the odd run out is carried over as a merge with nothing
+			const unsigned int start = bounds[runs - 1];
+			merges[count].a = src + start;
+			merges[count].a_size = size - start;
+			merges[count].b = NULL;
+			merges[count].b_size = 0;
+			merges[count].out = dst + start;
+			count++;
+		}
+
+		run_parallel_int(merge_task_run_int, merges, sizeof(merge_task_int), count);
+
+		for (unsigned int p = 0; p < pairs; p++)
+		{
+			bounds[p] = bounds[2 * p];
+		}
+		if (runs % 2 != 0)
+		{
+			bounds[pairs] = bounds[runs - 1];
+		}
+		runs = (runs + 1) / 2;
+		bounds[runs] = size;
+
+		int *temp = src;
+		src = dst;
+		dst = temp;
+	}
+
+	if (src != list->data)
+	{
+		memcpy(list->data, src, size * sizeof(int));
+	}
+	list_notify_reorder_int(list);
+	list->sorted = true;
+
+	free(scratch);
+	free(bounds);
+	free(merges);
+	free(sorts);
+	return 0;
+}
+
+
+void minmax_scalar_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index)
+{
+	unsigned int min_i = 0, max_i = 0;
+	for (unsigned int i = 1; i < size; i++)
+	{
+		if (data[i] < data[min_i]) min_i = i;
+		if (data[i] > data[max_i]) max_i = i;
+	}
+	*min_index = min_i;
+	*max_index = max_i;
+}
+
+
+#if LIST_X86_SIMD
+void minmax_reduce_int(const int *data, unsigned int size, unsigned int done, const int *min_vals,
+					   const unsigned int *min_lanes, const int *max_vals, const unsigned int *max_lanes,
+					   unsigned int lanes, unsigned int *min_index, unsigned int *max_index)
+{
+	// lanes only replace on a strict improvement, so on equal values the lowest index across lanes is the first one
+	unsigned int min_i = min_lanes[0], max_i = max_lanes[0];
+	for (unsigned int j = 1; j < lanes; j++)
+	{
+		if (min_vals[j] < data[min_i] || (min_vals[j] == data[min_i] && min_lanes[j] < min_i)) min_i = min_lanes[j];
+		if (max_vals[j] > data[max_i] || (max_vals[j] == data[max_i] && max_lanes[j] < max_i)) max_i = max_lanes[j];
+	}
+
+	for (unsigned int i = done; i < size; i++)
+	{
+		if (data[i] < data[min_i]) min_i = i;
+		if (data[i] > data[max_i]) max_i = i;
+	}
+	*min_index = min_i;
+	*max_index = max_i;
+}
+
+
+__attribute__((target("sse4.1")))
+void minmax_sse41_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index)
+{
+	if (size < 8)
+	{
+		minmax_scalar_int(data, size, min_index, max_index);
+		return;
+	}
+
+	__m128i index = _mm_setr_epi32(0, 1, 2, 3);
+	const __m128i step = _mm_set1_epi32(4);
+	__m128i min_val = _mm_loadu_si128((const __m128i *)data);
+	__m128i max_val = min_val;
+	__m128i min_lane = index;
+	__m128i max_lane = index;
+
+	unsigned int i = 4;
+	for (; i + 4 <= size; i += 4)
+	{
+		index = _mm_add_epi32(index, step);
+		const __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+		const __m128i lower = _mm_cmpgt_epi32(min_val, value);
+		const __m128i higher = _mm_cmpgt_epi32(value, max_val);
+		min_val = _mm_blendv_epi8(min_val, value, lower);
+		min_lane = _mm_blendv_epi8(min_lane, index, lower);
+		max_val = _mm_blendv_epi8(max_val, value, higher);
+		max_lane = _mm_blendv_epi8(max_lane, index, higher);
+	}
+
+	int min_vals[4], max_vals[4];
+	unsigned int min_lanes[4], max_lanes[4];
+	_mm_storeu_si128((__m128i *)min_vals, min_val);
+	_mm_storeu_si128((__m128i *)max_vals, max_val);
+	_mm_storeu_si128((__m128i *)min_lanes, min_lane);
+	_mm_storeu_si128((__m128i *)max_lanes, max_lane);
+	minmax_reduce_int(data, size, i, min_vals, min_lanes, max_vals, max_lanes, 4, min_index, max_index);
+}
+
+
+__attribute__((target("avx2")))
+void minmax_avx2_int(const int *data, unsigned int size, unsigned int *min_index, unsigned int *max_index)
+{
+	if (size < 16)
+	{
+		minmax_scalar_int(data, size, min_index, max_index);
+		return;
+	}
+
+	__m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i step = _mm256_set1_epi32(8);
+	__m256i min_val = _mm256_loadu_si256((const __m256i *)data);
+	__m256i max_val = min_val;
+	__m256i min_lane = index;
+	__m256i max_lane = index;
+
+	unsigned int i = 8;
+	for (; i + 8 <= size; i += 8)
+	{
+		index = _mm256_add_epi32(index, step);
+		const __m256i value = _mm256_loadu_si256((const __m256i *)(data + i));
+		const __m256i lower = _mm256_cmpgt_epi32(min_val, value);
+		const __m256i higher = _mm256_cmpgt_epi32(value, max_val);
+		min_val = _mm256_blendv_epi8(min_val, value, lower);
+		min_lane = _mm256_blendv_epi8(min_lane, index, lower);
+		max_val = _mm256_blendv_epi8(max_val, value, higher);
+		max_lane = _mm256_blendv_epi8(max_lane, index, higher);
+	}
+
+	int min_vals[8], max_vals[8];
+	unsigned int min_lanes[8], max_lanes[8];
+	_mm256_storeu_si256((__m256i *)min_vals, min_val);
+	_mm256_storeu_si256((__m256i *)max_vals, max_val);
+	_mm256_storeu_si256((__m256i *)min_lanes, min_lane);
+	_mm256_storeu_si256((__m256i *)max_lanes, max_lane);
+	minmax_reduce_int(data, size, i, min_vals, min_lanes, max_vals, max_lanes, 8, min_index, max_index);
+}
+#endif
+
+
+wide_int list_sum_values_int(const list_int *list)
+{
+	wide_int sum = 0;
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		sum += sum_arr_int(run, n);
+		i += n;
+	}
+	return sum;
+}
+
+
+void list_minmax_values_int(const list_int *list, unsigned int *min_index, unsigned int *max_index)
+{
+	// list->size > 0, a later run only takes over with a strictly smaller (larger) value so ties keep the first index
+	int min = 0, max = 0;
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		unsigned int run_min, run_max;
+		minmax_arr_int(run, n, &run_min, &run_max);
+		if (i == 0 || run[run_min] < min)
+		{
+			min = run[run_min];
+			*min_index = i + run_min;
+		}
+		if (i == 0 || run[run_max] > max)
+		{
+			max = run[run_max];
+			*max_index = i + run_max;
+		}
+		i += n;
+	}
+}
+
+
+void list_cache_refresh_int(list_int *list, bool minmax)
+{
+	list_cache_int *cache = list->cache;
+	if (cache->stale)
+	{
+		cache->sum = (long long)list_sum_values_int(list);
+		cache->stale = false;
+		cache->dirty = true;
+	}
+
+	if (minmax && cache->dirty && list->size > 0)
+	{
+		list_minmax_values_int(list, &cache->min_index, &cache->max_index);
+		cache->min = *list_slot_int(list, cache->min_index);
+		cache->max = *list_slot_int(list, cache->max_index);
+		cache->dirty = false;
+	}
+}
+
+
+wide_int list_total_int(list_int *list)
+{
+	if (list->cache != NULL)
+	{
+		list_cache_refresh_int(list, false);
+		return list->cache->sum;
+	}
+	return list_sum_values_int(list);
+}
+
+
+int list_minmax_int(list_int *list, int *min_val, long *min_index, int *max_val, long *max_index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (list->size == 0)
+	{
+		*min_index = -1;
+		*max_index = -1;
+		return -1;
+	}
+
+	unsigned int min_i, max_i;
+	if (list->sorted)
+	{
+		min_i = 0;
+		max_i = list_bound_int(list, 0, *list_slot_int(list, list->size - 1), false);
+	}
+	else if (list->cache != NULL)
+	{
+		list_cache_refresh_int(list, true);
+		min_i = list->cache->min_index;
+		max_i = list->cache->max_index;
+	}
+	else
+	{
+		list_minmax_values_int(list, &min_i, &max_i);
+	}
+	*min_val = *list_slot_int(list, min_i);
+	*min_index = min_i;
+	*max_val = *list_slot_int(list, max_i);
+	*max_index = max_i;
+	return 0;
+}
+
+
+int list_max_int(list_int *list, int *return_val, long *return_index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	int min_val;
+	long min_index;
+	return list_minmax_int(list, &min_val, &min_index, return_val, return_index);
+}
+
+
+int list_min_int(list_int *list, int *return_val, long *return_index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	int max_val;
+	long max_index;
+	return list_minmax_int(list, return_val, return_index, &max_val, &max_index);
+}
+
+
+int median_of_medians_int(int *arr, unsigned int size);
+
+
+void introselect_int(int *arr, unsigned int size, unsigned int k, unsigned int budget) // NOLINT(*-no-recursion)
+{
+	unsigned int left = 0;
+	unsigned int right = size;
+
+	while (right - left > LIST_SORT_INSERTION_THRESHOLD)
+	{
+		int pivot;
+		if (budget > 0)
+		{
+			budget--;
+			int a = arr[left], b = arr[left + (right - left) / 2], c = arr[right - 1];
+			if (a > b) swap_int(&a, &b);
+			if (b > c) swap_int(&b, &c);
+			if (a > b) swap_int(&a, &b);
+			pivot = b;
+		}
+		else
+		{
+			// quickselect kept picking bad pivots, switch to the guaranteed linear pivot
+			pivot = median_of_medians_int(arr + left, right - left);
+		}
+
+		// three way partition: [left, lt) < pivot, [lt, gt) = pivot, [gt, right) > pivot
+		unsigned int lt = left, i = left, gt = right;
+		while (i < gt)
+		{
+			if (arr[i] < pivot)
+			{
+				swap_int(&arr[lt++], &arr[i++]);
+			}
+			else if (arr[i] > pivot)
+			{
+				swap_int(&arr[i], &arr[--gt]);
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		if (k < lt)
+		{
+			right = lt;
+		}
+		else if (k >= gt)
+		{
+			left = gt;
+		}
+		else
+		{
+			return;
+		}
+	}
+	insertion_sort_int(arr + left, right - left);
+}
+
+
+int median_of_medians_int(int *arr, unsigned int size) // NOLINT(*-no-recursion)
+{
+	const unsigned int groups = (size + 4) / 5;
+	for (unsigned int g = 0; g < groups; g++)
+	{
+		const unsigned int start = g * 5;
+		const unsigned int length = size - start < 5 ? size - start : 5;
+		insertion_sort_int(arr + start, length);
+		swap_int(&arr[g], &arr[start + length / 2]);
+	}
+	introselect_int(arr, groups, groups / 2, 0);
+	return arr[groups / 2];
+}
+
+
+void select_int(int *arr, unsigned int size, unsigned int k)
+{
+	unsigned int budget = 0;
+	for (unsigned int n = size; n > 1; n >>= 1)
+	{
+		budget += 2;
+	}
+	introselect_int(arr, size, k, budget);
+}
+
+
+float median_arr_int(int *arr, unsigned int size)
+{
+	const unsigned int k = size / 2;
+	select_int(arr, size, k);
+
+	if (size % 2 != 0)
+	{
+		return (float)arr[k];
+	}
+
+	// after the selection the lower middle value is the largest value left of k
+	int lower = arr[0];
+	for (unsigned int i = 1; i < k; i++)
+	{
+		if (arr[i] > lower) lower = arr[i];
+	}
+	return (float)(((double)lower + (double)arr[k]) / 2.0);
+}
+
+
+int list_median_int(list_int *list, float *return_val)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (list->size == 0)
+	{
+		*return_val = 0;
+		return 0;
+	}
+
+	if (list->sorted)
+	{
+		return list_median_buf_int(list, NULL, return_val);
+	}
+
+	int *scratch = malloc(list->size * sizeof(int));
+	if (scratch == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation for median buffer failed.\n");
+		return -2;
+	}
+
+	const int state = list_median_buf_int(list, scratch, return_val);
+	free(scratch);
+	return state;
+}
+
+
+int list_median_buf_int(list_int *list, int *buffer, float *return_val)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (list->size == 0)
+	{
+		*return_val = 0;
+		return 0;
+	}
+
+	if (list->sorted)
+	{
+		const unsigned int k = list->size / 2;
+		*return_val = list->size % 2 != 0
+						  ? (float)*list_slot_int(list, k)
+						  : (float)(((double)*list_slot_int(list, k - 1) + (double)*list_slot_int(list, k)) / 2.0);
+		return 0;
+	}
+
+	if (buffer == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to use NULL buffer.\n");
+		return -1;
+	}
+
+	list_copy_int(list, buffer);
+	*return_val = median_arr_int(buffer, list->size);
+	return 0;
+}
+
+
+void multiselect_int(int *arr, unsigned int start, unsigned int end, const unsigned int *ranks, unsigned int count) // NOLINT(*-no-recursion)
+{
+	// ranks are sorted, unique and inside [start, end), selecting the middle one splits the rest into two halves
+	if (count == 0) return;
+
+	const unsigned int middle = count / 2;
+	const unsigned int rank = ranks[middle];
+	select_int(arr + start, end - start, rank - start);
+
+	multiselect_int(arr, start, rank, ranks, middle);
+	multiselect_int(arr, rank + 1, end, ranks + middle + 1, count - middle - 1);
+}
+
+
+int list_quantiles_int(list_int *list, const double *qs, unsigned int n, int *out)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (qs == NULL || out == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to use NULL array.\n");
+		return -1;
+	}
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to find quantiles of 0 size list.\n");
+		return -1;
+	}
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		if (!(qs[i] >= 0.0 && qs[i] <= 1.0))
+		{
+			fprintf(stderr, "Error: Quantile %f is outside of [0, 1].\n", qs[i]);
+			return -1;
+		}
+	}
+
+	if (n == 0)
+	{
+		return 0;
+	}
+
+	if (list->sorted)
+	{
+		for (unsigned int i = 0; i < n; i++)
+		{
+			out[i] = *list_slot_int(list, (unsigned int)(qs[i] * (list->size - 1) + 0.5));
+		}
+		return 0;
+	}
+
+	int *scratch = malloc(list->size * sizeof(int));
+	unsigned int *ranks = malloc(n * sizeof(unsigned int));
+	if (scratch == NULL || ranks == NULL)
+	{
+		free(scratch);
+		free(ranks);
+		fprintf(stderr, "Error: Memory allocation for quantile buffers failed.\n");
+		return -2;
+	}
+	list_copy_int(list, scratch);
+
+	// flipping the top bit makes the unsigned ranks sort correctly as int
+	for (unsigned int i = 0; i < n; i++)
+	{
+		ranks[i] = (unsigned int)(qs[i] * (list->size - 1) + 0.5) ^ 0x80000000u;
+	}
+	const int state = sort_arr_int((int *)ranks, n);
+	if (state != 0)
+	{
+		free(scratch);
+		free(ranks);
+		return state;
+	}
+
+	unsigned int unique = 0;
+	for (unsigned int i = 0; i < n; i++)
+	{
+		const unsigned int rank = ranks[i] ^ 0x80000000u;
+		if (unique == 0 || ranks[unique - 1] != rank)
+		{
+			ranks[unique++] = rank;
+		}
+	}
+
+	multiselect_int(scratch, 0, list->size, ranks, unique);
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		out[i] = scratch[(unsigned int)(qs[i] * (list->size - 1) + 0.5)];
+	}
+
+	free(scratch);
+	free(ranks);
+	return 0;
+}
+
+
+unsigned int hash_int(int key)
+{
+	unsigned int h = (unsigned int)key;
+	h ^= h >> 16;
+	h *= 0x7FEB352Du;
+	h ^= h >> 15;
+	h *= 0x846CA68Bu;
+	h ^= h >> 16;
+	return h;
+}
+
+
+int table_init_int(table_int *table, unsigned int expected)
+{
+	unsigned int capacity = 16;
+	while (capacity < expected && capacity <= UINT_MAX / 4)
+	{
+		capacity *= 2;
+	}
+	capacity *= 2; // keep the load factor under 1/2
+
+	table->keys = malloc(capacity * sizeof(int));
+	table->values = malloc(capacity * sizeof(unsigned int));
+	table->used = calloc(capacity, sizeof(bool));
+	if (table->keys == NULL || table->values == NULL || table->used == NULL)
+	{
+		free(table->keys);
+		free(table->values);
+		free(table->used);
+		table->keys = NULL;
+		table->values = NULL;
+		table->used = NULL;
+		return -2;
+	}
+	table->capacity = capacity;
+	table->count = 0;
+	return 0;
+}
+
+
+void table_free_int(table_int *table)
+{
+	free(table->keys);
+	free(table->values);
+	free(table->used);
+	table->keys = NULL;
+	table->values = NULL;
+	table->used = NULL;
+	table->capacity = 0;
+	table->count = 0;
+}
+
+
+unsigned int table_slot_int(const table_int *table, int key)
+{
+	const unsigned int mask = table->capacity - 1;
+	unsigned int slot = hash_int(key) & mask;
+	while (table->used[slot] && table->keys[slot] != key)
+	{
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+
+unsigned int *table_find_int(const table_int *table, int key)
+{
+	const unsigned int slot = table_slot_int(table, key);
+	return table->used[slot] ? &table->values[slot] : NULL;
+}
+
+
+int table_grow_int(table_int *table)
+{
+	if (table->capacity > UINT_MAX / 2)
+	{
+		return -2;
+	}
+
+	table_int grown;
+	if (table_init_int(&grown, table->capacity) != 0)
+	{
+		return -2;
+	}
+
+	for (unsigned int i = 0; i < table->capacity; i++)
+	{
+		if (!table->used[i]) continue;
+		const unsigned int slot = table_slot_int(&grown, table->keys[i]);
+		grown.used[slot] = true;
+		grown.keys[slot] = table->keys[i];
+		grown.values[slot] = table->values[i];
+	}
+	grown.count = table->count;
+
+	table_free_int(table);
+	*table = grown;
+	return 0;
+}
+
+
+unsigned int *table_insert_int(table_int *table, int key, bool *inserted)
+{
+	unsigned int slot = table_slot_int(table, key);
+	if (table->used[slot])
+	{
+		*inserted = false;
+		return &table->values[slot];
+	}
+
+	if (table->count + 1 > table->capacity / 2)
+	{
+		if (table_grow_int(table) != 0) return NULL;
+		slot = table_slot_int(table, key);
+	}
+
+	table->used[slot] = true;
+	table->keys[slot] = key;
+	table->values[slot] = 0;
+	table->count++;
+	*inserted = true;
+	return &table->values[slot];
+}
+
+
+int count_table_int(list_int *list, table_int *table)
+{
+	// a list with many repeats would waste a table sized for every value, so start smaller and let it grow
+	if (table_init_int(table, list->size < 65536 ? list->size : 65536) != 0)
+	{
+		return -2;
+	}
+
+	bool inserted;
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		for (unsigned int j = 0; j < n; j++)
+		{
+			unsigned int *count = table_insert_int(table, run[j], &inserted);
+			if (count == NULL)
+			{
+				table_free_int(table);
+				return -2;
+			}
+			(*count)++;
+		}
+		i += n;
+	}
+	return 0;
+}
+
+
+int table_erase_int(table_int *table, int key)
+{
+	const unsigned int mask = table->capacity - 1;
+	unsigned int slot = table_slot_int(table, key);
+	if (!table->used[slot]) return -1;
+
+	// backward shift deletion, later entries of the probe run move into the hole so no tombstones are needed
+	for (unsigned int next = (slot + 1) & mask; table->used[next]; next = (next + 1) & mask)
+	{
+		const unsigned int home = hash_int(table->keys[next]) & mask;
+		if (((next - home) & mask) >= ((next - slot) & mask))
+		{
+			table->keys[slot] = table->keys[next];
+			table->values[slot] = table->values[next];
+			slot = next;
+		}
+	}
+	table->used[slot] = false;
+	table->count--;
+	return 0;
+}
+
+
+int list_index_build_int(list_int *list)
+{
+	list_index_int *index = list->hash_index;
+	if (index->table.used != NULL && index->table.capacity / 2 >= list->size)
+	{
+		memset(index->table.used, 0, index->table.capacity * sizeof(bool));
+		index->table.count = 0;
+	}
+	else
+	{
+		table_free_int(&index->table);
+		if (table_init_int(&index->table, list->size) != 0)
+		{
+			index->stale = true;
+			return -2;
+		}
+	}
+
+	if (index->moved.used != NULL)
+	{
+		memset(index->moved.used, 0, index->moved.capacity * sizeof(bool));
+		index->moved.count = 0;
+	}
+	else if (table_init_int(&index->moved, 0) != 0)
+	{
+		index->stale = true;
+		return -2;
+	}
+
+	index->base = 0;
+	for (unsigned int i = 0; i < list->size;)
+	{
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		for (unsigned int j = 0; j < n; j++)
+		{
+			bool inserted;
+			unsigned int *first = table_insert_int(&index->table, run[j], &inserted);
+			if (inserted) *first = i + j;
+		}
+		i += n;
+	}
+	index->stale = false;
+	return 0;
+}
+
+
+bool list_index_shift_int(list_int *list, unsigned int from, unsigned int count, bool up)
+{
+	// moves every first occurrence at or after from by count, a table too large to walk is marked stale instead
+	list_index_int *index = list->hash_index;
+	if (from == 0)
+	{
+		if (up) index->base -= count;
+		else index->base += count;
+		return true;
+	}
+	if (from >= list->size) return true;
+	if (index->table.capacity > LIST_INDEX_SHIFT_MAX)
+	{
+		index->stale = true;
+		return false;
+	}
+
+	for (unsigned int slot = 0; slot < index->table.capacity; slot++)
+	{
+		if (!index->table.used[slot] || index->table.values[slot] - index->base < from) continue;
+		if (up) index->table.values[slot] += count;
+		else index->table.values[slot] -= count;
+	}
+	return true;
+}
+
+
+void list_index_add_int(list_index_int *index, int value, unsigned int position)
+{
+	// a value whose first occurrence is still unknown stays unknown, position may come after it
+	if (index->moved.count != 0 && table_find_int(&index->moved, value) != NULL) return;
+
+	bool inserted;
+	unsigned int *first = table_insert_int(&index->table, value, &inserted);
+	if (first == NULL)
+	{
+		index->stale = true;
+		return;
+	}
+	if (inserted || *first - index->base > position) *first = position + index->base;
+}
+
+
+void list_index_drop_int(list_int *list, int value)
+{
+	// the next occurrence of value is searched when it is looked up instead of on every removal
+	list_index_int *index = list->hash_index;
+	bool inserted;
+	table_erase_int(&index->table, value);
+	if (index->moved.count >= list->size || table_insert_int(&index->moved, value, &inserted) == NULL)
+	{
+		index->stale = true;
+	}
+}
+
+
+void list_index_insert_int(list_int *list, unsigned int index, const int *values, unsigned int count)
+{
+	list_index_int *hash_index = list->hash_index;
+	if (hash_index == NULL || hash_index->stale || count == 0) return;
+
+	if (!list_index_shift_int(list, index + count < list->size ? index : list->size, count, true)) return;
+	for (unsigned int i = 0; i < count && !hash_index->stale; i++)
+	{
+		list_index_add_int(hash_index, values[i], index + i);
+	}
+}
+
+
+void list_index_remove_int(list_int *list, unsigned int index, const int *values, unsigned int count)
+{
+	list_index_int *hash_index = list->hash_index;
+	if (hash_index == NULL || hash_index->stale || count == 0) return;
+
+	const unsigned int end = index + count;
+	if (index != 0 && end < list->size && count > LIST_INDEX_RESCAN_MAX)
+	{
+		hash_index->stale = true;
+		return;
+	}
+
+	for (unsigned int i = 0; i < count && !hash_index->stale; i++)
+	{
+		const unsigned int *first = table_find_int(&hash_index->table, values[i]);
+		if (first == NULL) continue;
+		const unsigned int position = *first - hash_index->base;
+		if (position >= index && position < end) list_index_drop_int(list, values[i]);
+	}
+
+	if (!hash_index->stale) list_index_shift_int(list, index == 0 ? 0 : end, count, false);
+}
+
+
+void list_index_set_int(list_int *list, unsigned int index, int old_value, int value)
+{
+	list_index_int *hash_index = list->hash_index;
+	if (hash_index == NULL || hash_index->stale || old_value == value) return;
+
+	const unsigned int *first = table_find_int(&hash_index->table, old_value);
+	if (first != NULL && *first - hash_index->base == index) list_index_drop_int(list, old_value);
+	if (!hash_index->stale) list_index_add_int(hash_index, value, index);
+}
+
+
+int list_index_find_int(list_int *list, int value, unsigned int *first)
+{
+	// 0: *first is the first occurrence, 1: value is not in the list, -1: no usable index
+	list_index_int *index = list->hash_index;
+	if (index == NULL) return -1;
+	if (index->stale && list_index_build_int(list) != 0) return -1;
+
+	const unsigned int *found = table_find_int(&index->table, value);
+	if (found != NULL)
+	{
+		*first = *found - index->base;
+		return 0;
+	}
+	if (index->moved.count == 0 || table_erase_int(&index->moved, value) != 0) return 1;
+
+	const unsigned int next = list_find_int(list, 0, value);
+	if (next == list->size) return 1;
+	list_index_add_int(index, value, next);
+	*first = next;
+	return 0;
+}
+
+
+int list_enable_index_int(list_int *list)
+{
+	assert(list != NULL);
+	if (list->hash_index != NULL) return 0;
+
+	list->hash_index = calloc(1, sizeof(list_index_int));
+	if (list->hash_index == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation for list->hash_index failed.\n");
+		return -2;
+	}
+
+	if (list_index_build_int(list) != 0)
+	{
+		table_free_int(&list->hash_index->table);
+		table_free_int(&list->hash_index->moved);
+		free(list->hash_index);
+		list->hash_index = NULL;
+		fprintf(stderr, "Error: Memory allocation for list->hash_index failed.\n");
+		return -2;
+	}
+	return 0;
+}
+
+
+void list_disable_index_int(list_int *list)
+{
+	assert(list != NULL);
+	if (list->hash_index == NULL) return;
+
+	table_free_int(&list->hash_index->table);
+	table_free_int(&list->hash_index->moved);
+	free(list->hash_index);
+	list->hash_index = NULL;
+}
+
+
+int list_mode_int(list_int *list, int *return_val, unsigned int *return_amount, bool sort)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to find values in 0 size list");
+		return -1;
+	}
+
+	if (list->size == 1)
+	{
+		*return_val = list->data[0];
+		*return_amount = 1;
+		return 0;
+	}
+
+	int max = list->data[0];
+	unsigned int count = 1, max_count = 1;
+
+	if (list->sorted || (sort && list_sort_int(list) == 0))
+	{
+		max = list->data[0];
+		for (unsigned int i = 1; i < list->size; i++)
+		{
+			if (list->data[i] == list->data[i - 1]) count++;
+			else count = 1;
+			if (count > max_count)
+			{
+				max_count = count;
+				max = list->data[i];
+			}
+		}
+
+		*return_val = max;
+		*return_amount = max_count;
+		return 0;
+	}
+
+	int lo, hi;
+	if (list->size >= LIST_SORT_RADIX_THRESHOLD && narrow_range_arr_int(list->data, list->size, &lo, &hi))
+	{
+		const unsigned int range = (unsigned int)hi - (unsigned int)lo + 1;
+		unsigned int *counts = malloc(range * sizeof(unsigned int));
+		if (counts != NULL)
+		{
+			memset(counts, 0, range * sizeof(unsigned int));
+			histogram_arr_int(list->data, list->size, lo, range, counts);
+			max_count = 0;
+			for (unsigned int d = 0; d < range; d++)
+			{
+				if (counts[d] > max_count)
+				{
+					max_count = counts[d];
+					max = (int)((unsigned int)lo + d);
+				}
+			}
+			free(counts);
+
+			*return_val = max;
+			*return_amount = max_count;
+			return 0;
+		}
+	}
+
+	table_int table;
+	if (count_table_int(list, &table) == 0)
+	{
+		// ties go to the smallest value, the same answer the sorted scan gives
+		for (unsigned int i = 0; i < table.capacity; i++)
+		{
+			if (!table.used[i]) continue;
+			if (table.values[i] > max_count || (table.values[i] == max_count && table.keys[i] < max))
+			{
+				max_count = table.values[i];
+				max = table.keys[i];
+			}
+		}
+		table_free_int(&table);
+
+		*return_val = max;
+		*return_amount = max_count;
+		return 0;
+	}
+
+	max_count = 0;
+	for (unsigned int i = 0; i < list->size; i++)
+	{
+		count = 0;
+		const int temp = list->data[i];
+		for (unsigned int k = i; k < list->size; k++)
+		{
+			if (list->data[k] == temp) count++;
+		}
+		if (count > max_count || (count == max_count && temp < max))
+		{
+			max_count = count;
+			max = temp;
+		}
+	}
+
+	*return_val = max;
+	*return_amount = max_count;
+	return 0;
+}
+
+
+bool frequent_before_int(int value_a, unsigned int count_a, int value_b, unsigned int count_b)
+{
+	return count_a > count_b || (count_a == count_b && value_a < value_b);
+}
+
+
+void frequent_sift_down_int(int *values, unsigned int *counts, unsigned int size, unsigned int index)
+{
+	// min heap on frequency, the least frequent kept value sits at the root
+	while (true)
+	{
+		const unsigned int left = 2 * index + 1;
+		const unsigned int right = left + 1;
+		unsigned int worst = index;
+
+		if (left < size && frequent_before_int(values[worst], counts[worst], values[left], counts[left]))
+		{
+			worst = left;
+		}
+		if (right < size && frequent_before_int(values[worst], counts[worst], values[right], counts[right]))
+		{
+			worst = right;
+		}
+		if (worst == index) return;
+
+		swap_int(&values[index], &values[worst]);
+		const unsigned int temp = counts[index];
+		counts[index] = counts[worst];
+		counts[worst] = temp;
+		index = worst;
+	}
+}
+
+
+int list_top_k_frequent_int(list_int *list, unsigned int k, int *values, unsigned int *counts, unsigned int *return_k)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (values == NULL || counts == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to assign values to NULL address.\n");
+		*return_k = 0;
+		return -1;
+	}
+
+	*return_k = 0;
+	if (list->size == 0 || k == 0)
+	{
+		return 0;
+	}
+
+	table_int table;
+	if (count_table_int(list, &table) != 0)
+	{
+		fprintf(stderr, "Error: Memory allocation for frequency table failed.\n");
+		return -2;
+	}
+
+	unsigned int size = 0;
+	for (unsigned int i = 0; i < table.capacity; i++)
+	{
+		if (!table.used[i]) continue;
+
+		if (size < k)
+		{
+			values[size] = table.keys[i];
+			counts[size] = table.values[i];
+			size++;
+			if (size == k)
+			{
+				for (unsigned int j = k / 2; j-- > 0;)
+				{
+					frequent_sift_down_int(values, counts, size, j);
+				}
+			}
+		}
+		else if (frequent_before_int(table.keys[i], table.values[i], values[0], counts[0]))
+		{
+			values[0] = table.keys[i];
+			counts[0] = table.values[i];
+			frequent_sift_down_int(values, counts, size, 0);
+		}
+	}
+	table_free_int(&table);
+
+	if (size < k)
+	{
+		for (unsigned int j = size / 2; j-- > 0;)
+		{
+			frequent_sift_down_int(values, counts, size, j);
+		}
+	}
+
+	// pop the least frequent to the back until the heap is empty, leaving the most frequent first
+	for (unsigned int end = size; end > 1; end--)
+	{
+		swap_int(&values[0], &values[end - 1]);
+		const unsigned int temp = counts[0];
+		counts[0] = counts[end - 1];
+		counts[end - 1] = temp;
+		frequent_sift_down_int(values, counts, end - 1, 0);
+	}
+
+	*return_k = size;
+	return 0;
+}
+
+
+int list_range_int(list_int *list, int *return_val)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	*return_val = 0;
+
+	int min, max;
+	long min_index, max_index;
+	if (list_minmax_int(list, &min, &min_index, &max, &max_index) != 0)
+	{
+		return 0;
+	}
+
+	const unsigned int range = (unsigned int)max - (unsigned int)min;
+	if (range > INT_MAX)
+	{
+		fprintf(stderr, "Error: Range %u cannot be represented as an int.\n", range);
+		return -1;
+	}
+	*return_val = (int)range;
+	return 0;
+}
+
+
+int list_ring_ready_int(list_int *list)
+{
+	// 0: the ring can take the insert, 1: use the contiguous path, -2: failed memory reallocation
+	// slots wrap with a mask, so the capacity is rounded up to a power of 2, after growing it first if it is full
+	unsigned int capacity = list->capacity;
+	if (list->size == capacity)
+	{
+		if (capacity == UINT_MAX) return 1;
+		capacity = list_grow_capacity_int(list, capacity + 1);
+	}
+
+	if ((capacity & (capacity - 1)) != 0)
+	{
+		if (capacity > 1u << 31) return 1;
+		capacity = 1u << (32 - __builtin_clz(capacity - 1));
+	}
+
+	if (capacity == list->capacity) return 0;
+	if (list->frozen) return 1;
+	return list_resize_int(list, capacity) == 0 ? 0 : -2;
+}
+
+
+int list_push_front_int(list_int *list, int value)
+{
+	return list_insert_int(list, 0, value);
+}
+
+
+int list_pop_front_int(list_int *list, int *return_val)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to remove from 0 size list.\n");
+		return -1;
+	}
+
+	return list_take_int(list, 0, return_val);
+}
+
+
+int list_append_int(list_int *list, int value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (list->ring_buffer || list->gap_buffer)
+	{
+		return list_insert_int(list, list->size, value);
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (list->size >= list->capacity)
+	{
+		if (list->frozen) return 0;
+		if (list->size == UINT_MAX)
+		{
+			fprintf(
+				stderr,
+				"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add: %u)",
+				UINT_MAX, list->capacity, 1);
+			return -2;
+		}
+		// ReSharper disable once CppLocalVariableMayBeConst
+		int state = list_resize_int(list, list_grow_capacity_int(list, list->size + 1));
+		if (state == -2)
+		{
+			fprintf(stderr, "Error: Value could not be added due to failed memory reallocation.\n");
+			return -2;
+		}
+	}
+	list->data[list->size++] = value;
+	list_notify_insert_int(list, list->size - 1, &value, 1);
+	return 0;
+}
+
+
+int list_insert_int(list_int *list, unsigned int index, int value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (index > list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (list->ring_buffer && (index == 0 || index == list->size))
+	{
+		const int ready = list_ring_ready_int(list);
+		if (ready == -2)
+		{
+			fprintf(stderr, "Error: Value could not be added due to failed memory reallocation.\n");
+			return -2;
+		}
+		if (ready == 0)
+		{
+			if (index == 0) list->head = (list->head - 1) & (list->capacity - 1);
+			list->size++;
+			*list_slot_int(list, index) = value;
+			list_notify_insert_int(list, index, &value, 1);
+			return 0;
+		}
+	}
+
+	if (list->size >= list->capacity && list->frozen)
+	{
+		return 0;
+	}
+
+	if (!list->gap_buffer)
+	{
+		return list_splice_int(list, index, 0, &value, 1);
+	}
+
+	if (list->size >= list->capacity)
+	{
+		if (list->size == UINT_MAX)
+		{
+			fprintf(
+				stderr,
+				"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add: %u)",
+				UINT_MAX, list->capacity, 1);
+			return -2;
+		}
+		// ReSharper disable once CppLocalVariableMayBeConst
+		int state = list_resize_int(list, list_grow_capacity_int(list, list->size + 1));
+		if (state == -2)
+		{
+			fprintf(stderr, "Error: Value could not be added due to failed memory reallocation.\n");
+			return -2;
+		}
+	}
+
+	list_gap_move_int(list, index);
+	list->data[list->gap_start++] = value;
+	list->gap_size--;
+	list->size++;
+	list_notify_insert_int(list, index, &value, 1);
+	return 0;
+}
+
+
+int list_get_int(list_int *list, unsigned int index, int *value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+	*value = *list_slot_int(list, index);
+	return 0;
+}
+
+
+int list_set_int(list_int *list, unsigned int index, int value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	int *slot = list_slot_int(list, index);
+	list_notify_set_int(list, index, *slot, value);
+	*slot = value;
+	return 0;
+}
+
+
+int list_pop_back_int(list_int *list, int *return_val)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+
+	if (list->size == 0)
+	{
+		fprintf(stderr, "Error: Attempt to remove from 0 size list.\n");
+		return 0;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	return list_take_int(list, list->size - 1, return_val);
+}
+
+int list_remove_at_int(list_int *list, unsigned int index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (list->ring_buffer && (index == 0 || index == list->size - 1) && (list->capacity & (list->capacity - 1)) == 0)
+	{
+		// either end of a ring is removed by moving head or shortening it, removing never reallocates, so until an
+		// insert rounds the capacity up to a power of 2 (the head is still 0) the contiguous path is taken
+		// the policy shrink is skipped as well, it would linearize the ring, list_shrink_int() releases the memory
+		list_notify_remove_int(list, index, list_slot_int(list, index), 1);
+		if (index == 0) list->head = list->size == 1 ? 0 : (list->head + 1) & (list->capacity - 1);
+		list->size--;
+		return 0;
+	}
+	else if (list->gap_buffer)
+	{
+		// the removed value is the first one behind the gap, which simply grows over it
+		list_gap_move_int(list, index);
+		list_notify_remove_int(list, index, list_slot_int(list, index), 1);
+		list->gap_size++;
+	}
+	else
+	{
+		list_linearize_int(list);
+		list_notify_remove_int(list, index, &list->data[index], 1);
+		memmove(list->data + index, list->data + index + 1, sizeof(int) * (list->size - 1 - index));
+	}
+
+	list->size--;
+	return list_shrink_policy_int(list);
+}
+
+
+int list_swap_remove_int(list_int *list, unsigned int index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	// the freed slot has to be the last one, so an open gap is closed first, a ring simply gets shorter
+	if (list->gap_size != 0)
+	{
+		list_linearize_int(list);
+	}
+
+	int *last = list_slot_int(list, list->size - 1);
+	if (index != list->size - 1)
+	{
+		int *slot = list_slot_int(list, index);
+		list_notify_set_int(list, index, *slot, *last);
+		*slot = *last;
+	}
+	list_notify_remove_int(list, list->size - 1, last, 1);
+	list->size--;
+	return 0;
+}
+
+
+int list_remove_int(list_int *list, int value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (!list_bloom_maybe_int(list, value))
+	{
+		return -1;
+	}
+
+	unsigned int first;
+	const int indexed = list_index_find_int(list, value, &first);
+	if (indexed != -1)
+	{
+		return indexed == 0 ? list_remove_at_int(list, first) : -1;
+	}
+
+	if (list->sorted)
+	{
+		const unsigned int i = lower_bound_arr_int(list->data, 0, list->size, value);
+		return i < list->size && list->data[i] == value ? list_remove_at_int(list, i) : -1;
+	}
+
+	const unsigned int i = find_arr_int(list->data, 0, list->size, value);
+	return i < list->size ? list_remove_at_int(list, i) : -1;
+}
+
+
+int list_compact_int(list_int *list, unsigned int kept)
+{
+	// the values to keep are packed into list->data[0, kept), shrinks capacity at most once as list->policy allows
+	list_notify_filter_int(list, list->size - kept);
+	list->size = kept;
+	return list_shrink_policy_int(list);
+}
+
+
+int list_remove_all_int(list_int *list, int target)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (!list_bloom_maybe_int(list, target))
+	{
+		return -1;
+	}
+
+	const unsigned int kept = list_kernels.compact(list->data, list->size, target);
+	if (kept == list->size)
+	{
+		return -1;
+	}
+	return list_compact_int(list, kept);
+}
+
+
+int list_remove_all_unordered_int(list_int *list, int target)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	if (!list_bloom_maybe_int(list, target))
+	{
+		return -1;
+	}
+
+	// each hole is filled with the last value that is not target, and the end of the list moves down past it
+	int *data = list->data;
+	unsigned int end = list->size;
+	bool moved = false;
+	unsigned int i = find_arr_int(data, 0, end, target);
+	while (i < end)
+	{
+		end--;
+		while (end > i && data[end] == target)
+		{
+			end--;
+		}
+		if (end == i) break;
+		data[i] = data[end];
+		moved = true;
+		i = find_arr_int(data, i + 1, end, target);
+	}
+
+	if (end == list->size)
+	{
+		return -1;
+	}
+	list_notify_filter_int(list, list->size - end);
+	list->size = end;
+	if (moved)
+	{
+		list_notify_reorder_int(list);
+	}
+	return 0;
+}
+
+
+int list_remove_if_int(list_int *list, bool (*predicate)(int value, void *ctx), void *ctx)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (predicate == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to filter with NULL predicate.\n");
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	unsigned int kept = 0;
+	for (unsigned int i = 0; i < list->size; i++)
+	{
+		const int value = list->data[i];
+		list->data[kept] = value;
+		kept += !predicate(value, ctx);
+	}
+	return list_compact_int(list, kept);
+}
+
+
+int list_remove_indices_int(list_int *list, const unsigned int *indices, unsigned int k)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+
+	if (indices == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to remove NULL array of indices.\n");
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	for (unsigned int j = 0; j < k; j++)
+	{
+		if (indices[j] >= list->size)
+		{
+			fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", indices[j],
+					list->size);
+			return -1;
+		}
+	}
+
+	if (k == 0)
+	{
+		return 0;
+	}
+
+	// one bit per position removes duplicates and yields the indices in ascending order
+	const unsigned int words = (unsigned int)(((unsigned long long)list->size + 63) / 64);
+	unsigned long long *marked = calloc(words, sizeof(unsigned long long));
+	if (marked == NULL)
+	{
+		fprintf(stderr, "Error: Memory allocation failed.\n");
+		return -2;
+	}
+
+	for (unsigned int j = 0; j < k; j++)
+	{
+		marked[indices[j] / 64] |= 1ull << (indices[j] % 64);
+	}
+
+	// every run of kept values between two removed positions is moved once
+	unsigned int read = 0;
+	unsigned int write = 0;
+	for (unsigned int w = 0; w < words; w++)
+	{
+		for (unsigned long long bits = marked[w]; bits != 0; bits &= bits - 1)
+		{
+			const unsigned int index = w * 64 + (unsigned int)__builtin_ctzll(bits);
+			if (write != read) memmove(list->data + write, list->data + read, (index - read) * sizeof(int));
+			write += index - read;
+			read = index + 1;
+		}
+	}
+	if (write != read) memmove(list->data + write, list->data + read, (list->size - read) * sizeof(int));
+	write += list->size - read;
+
+	free(marked);
+	return list_compact_int(list, write);
+}
+
+
+int list_remove_range_int(list_int *list, unsigned int start_index, unsigned int end_index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+	if (end_index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", end_index, list->size);
+		return -1;
+	}
+
+	if (start_index >= end_index)
+	{
+		fprintf(stderr, "Error: start_index is greater than end_index");
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	return list_splice_int(list, start_index, end_index - start_index, NULL, 0);
+}
+
+
+int list_take_int(list_int *list, unsigned int index, int *value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (index >= list->size)
+	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		return -1;
+	}
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	*value = *list_slot_int(list, index);
+	return list_remove_at_int(list, index);
 }
 
 
-int list_destroy_int(list_int **list)
+int list_shrink_int(list_int *list)
 {
-	if (list == NULL) return 0;
-	if (*list == NULL) return 0;
-
-	if ((*list)->static_)
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+	if (list->frozen)
 	{
-		fprintf(stderr, "Error: Attempt to destroy a static list.\n");
+		fprintf(stderr, "Error: Attempt to resize frozen list.\n");
+		return -1;
+	}
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
 		return -3;
 	}
 
-	free((*list)->data);
-	(*list)->data = NULL;
-	free(*list);
-	*list = NULL;
-	return 0;
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+	return list_resize_int(list, list->size > list->policy.min_capacity ? list->size : list->policy.min_capacity);
 }
 
 
-int list_clear_int(list_int *list)
+int list_resize_int(list_int *list, unsigned int new_size)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
-
+	list_linearize_int(list);
 	if (list->frozen)
 	{
-		list->size = 0;
-		return 0;
+		fprintf(stderr, "Error: Attempt to resize a frozen list.\n");
 	}
 
 	if (list->readonly)
@@ -322,18 +3769,37 @@ int list_clear_int(list_int *list)
 		return -3;
 	}
 
-	if (list_resize_int(list, 0) == 0)
+	const unsigned int true_size = new_size == 0 ? 1 : new_size;
+
+	if (new_size < list->size)
 	{
-		return 0;
+		list_notify_remove_int(list, new_size, list->data + new_size, list->size - new_size);
+	}
+
+	int *new_data = realloc(list->data, sizeof(int) * true_size);
+
+	if (new_data == NULL)
+	{
+		list_notify_reset_int(list);
+		fprintf(stderr, "Error: Memory reallocation failed.\n");
+		return -2;
 	}
-	return -2;
+	list->data = new_data;
+	list->capacity = true_size;
+	list->size = list->size >= new_size ? new_size : list->size;
+	return 0;
 }
 
 
-int list_reverse_int(list_int *list)
+int list_set_policy_int(list_int *list, const list_policy_int *policy)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	if (policy == NULL || !(policy->growth_factor > 1.0) || policy->shrink_divisor < 2)
+	{
+		fprintf(stderr, "Error: Invalid list policy.\n");
+		return -1;
+	}
 
 	if (list->readonly)
 	{
@@ -347,80 +3813,70 @@ int list_reverse_int(list_int *list)
 		return -3;
 	}
 
-	for (unsigned int i = 0; i < list->size / 2; i++)
+	list->policy = *policy;
+	if (list->frozen || list->capacity >= policy->min_capacity) return 0;
+	if (list_resize_int(list, policy->min_capacity) != 0)
 	{
-		swap_int(&list->data[i], &list->data[list->size - i - 1]);
+		fprintf(stderr, "Error: Policy capacity could not be reserved due to failed memory reallocation.\n");
+		return -2;
 	}
 	return 0;
 }
 
 
-void merge_int(int *arr, int left, int mid, int right)
+int list_to_arr_int(list_int *list, int **arr, unsigned int *size)
 {
-	const int n1 = mid - left + 1;
-	const int n2 = right - mid;
-
-	int L[n1];
-	int R[n2];
-
-	for (unsigned int i = 0; i < n1; i++)
-	{
-		L[i] = arr[left + i];
-	}
-	for (unsigned int j = 0; j < n2; j++)
+	assert(list != NULL);
+	assert(list->data != NULL);
+	if (arr == NULL)
 	{
-		R[j] = arr[mid + 1 + j];
+		*size = 0;
+		fprintf(stderr, "Error: Attempt to assign values to NULL arr.\n");
+		return -1;
 	}
 
-	int i = 0, j = 0, k = left;
-	while (i < n1 && j < n2)
+	if (*arr != NULL)
 	{
-		if (L[i] <= R[j])
-		{
-			arr[k] = L[i];
-			i++;
-		} else
-		{
-			arr[k] = R[j];
-			j++;
-		}
-		k++;
+		fprintf(stderr, "Error: *arr is not NULL.\n");
+		*arr = NULL;
 	}
 
-	while (i < n1)
+	if (list->size == 0)
 	{
-		arr[k] = L[i];
-		i++;
-		k++;
+		*size = 0;
+		return 0;
 	}
 
-	while (j < n2)
+	*arr = malloc(sizeof(int) * list->size);
+	if (*arr == NULL)
 	{
-		arr[k] = R[j];
-		j++;
-		k++;
+		fprintf(stderr, "Error: Memory allocation for arr failed.\n");
+		*size = 0;
+		return -2;
 	}
-}
-
-
-void merge_sort_int(int *arr, int left, int right) // NOLINT(*-no-recursion)
-{
-	if (left < right)
-	{
-		const int mid = left + (right - left) / 2;
-
-		merge_sort_int(arr, left, mid);
-		merge_sort_int(arr, mid + 1, right);
 
-		merge_int(arr, left, mid, right);
-	}
+	*size = list->size;
+	list_copy_int(list, *arr);
+	return 0;
 }
 
 
-int list_sort_int(list_int *list)
+int list_reset_int(list_int *list, int *arr, unsigned int size)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
+	if (arr == NULL)
+	{
+		fprintf(stderr, "Error: Attempt to copy NULL array.\n");
+		return -1;
+	}
+
+	if (list->frozen && size != list->capacity)
+	{
+		fprintf(stderr, "Error: Attempt to resize frozen list.\n");
+		return -3;
+	}
 
 	if (list->readonly)
 	{
@@ -434,69 +3890,56 @@ int list_sort_int(list_int *list)
 		return -3;
 	}
 
-	merge_sort_int(list->data, 0, (int)list->size - 1);
-	return 0;
-}
-
-
-int list_max_int(list_int *list, int *return_val, long *return_index)
-{
-	assert(list != NULL);
-	assert(list->data != NULL);
-
-	if (list->size == 0)
+	if (size == 0)
 	{
-		*return_index = -1;
-		return -1;
+		list_clear_int(list);
+		return 0;
 	}
 
-	*return_val = INT_MIN;
-
-	for (unsigned int i = 0; i < list->size; i++)
+	if (size > list->capacity)
 	{
-		if (*return_val < list->data[i])
+		const unsigned int capacity = list_grow_capacity_int(list, size);
+		int *new_data = realloc(list->data, sizeof(int) * capacity);
+		if (new_data == NULL)
 		{
-			*return_val = list->data[i];
-			*return_index = i;
+			fprintf(stderr, "Error: Memory reallocation failed.\n");
+			return -2;
 		}
+		list->data = new_data;
+		list->capacity = capacity;
 	}
-
-	return 0;
+	memcpy(list->data, arr, sizeof(int) * size);
+	list->size = size;
+	list_notify_reset_int(list);
+	return list_shrink_policy_int(list);
 }
 
 
-int list_min_int(list_int *list, int *return_val, long *return_index)
+int list_write_arr_int(list_int *list, int *arr, unsigned int size, unsigned int index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
 
-	if (list->size == 0)
+	if (arr == NULL)
 	{
-		*return_index = -1;
+		fprintf(stderr, "Error: Attempt to write NULL to list.\n");
 		return -1;
 	}
 
-	*return_val = INT_MAX;
-
-	for (unsigned int i = 0; i < list->size; i++)
+	if (index > list->size)
 	{
-		if (*return_val > list->data[i])
-		{
-			*return_val = list->data[i];
-			*return_index = i;
-		}
+		fprintf(stderr, "Error: Attempt to write out of list bounds.\n");
+		return -1;
 	}
-	return 0;
-}
 
-int list_median_int(list_int *list, float *return_val)
-{
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (list->size == 0)
+	if (UINT_MAX - (list->size - index) <= size)
 	{
-		*return_val = 0;
-		return 0;
+		fprintf(
+			stderr,
+			"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add %u:)",
+			UINT_MAX, list->capacity, size);
+		return -2;
 	}
 
 	if (list->readonly)
@@ -511,585 +3954,653 @@ int list_median_int(list_int *list, float *return_val)
 		return -3;
 	}
 
-	list_sort_int(list);
-	*return_val = (float)(list->data[list->size / 2]);
-	if (list->size % 2 == 0)
+	if (size == 0)
+	{
+		return 0;
+	}
+
+	const unsigned int needed_mem = size + index;
+	unsigned int new_capacity = list->capacity;
+	if (needed_mem > list->capacity && !list->frozen)
+	{
+		new_capacity = list_grow_capacity_int(list, needed_mem);
+		const int success = list_resize_int(list, new_capacity);
+		if (success == -2)
+		{
+			fprintf(stderr, "Error: Memory reallocation failure.\n");
+			return -2;
+		}
+	}
+
+	const unsigned int old_size = list->size;
+	for (unsigned int i = index; i < size + index && i < list->capacity; i++)
+	{
+		if (i < old_size) list_notify_set_int(list, i, list->data[i], arr[i - index]);
+		list->data[i] = arr[i - index];
+	}
+
+	list->capacity = list->frozen ? list->capacity : new_capacity;
+	list->size = size + index > list->size ? (list->frozen ? list->capacity : size + index) : list->size;
+	if (list->size > old_size)
 	{
-		*return_val = (*return_val + (float)list->data[list->size / 2 - 1]) / 2.f;
+		list_notify_insert_int(list, old_size, list->data + old_size, list->size - old_size);
 	}
 
 	return 0;
 }
 
-int list_mode_int(list_int *list, int *return_val, unsigned int *return_amount, bool sort)
+
+int list_contains_int(list_int *list, int target, long *return_index, unsigned int start_index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
-	int *sorted = NULL;
 
 	if (list->size == 0)
 	{
-		fprintf(stderr, "Error: Attempt to find values in 0 size list");
-		return -1;
-	}
-
-	if (list->size == 1)
-	{
-		*return_val = list->data[0];
-		*return_amount = 1;
+		*return_index = -1;
 		return 0;
 	}
 
-	if (sort)
-	{
-		const int state = list_sort_int(list);
-		if (state == -3)
-		{
-			sort = false;
-		}
-		else
-		{
-			sorted = list->data;
-		}
-	}
-
-	bool mem_allocated = false;
-	int max = list->data[0], count = 0, max_count = 0;
-	if (!sort)
+	if (start_index >= list->size)
 	{
-		sorted = malloc(list->size * sizeof(int));
-		if (sorted)
-		{
-			memcpy(sorted, list->data, list->size * sizeof(int));
-			sort = true;
-			mem_allocated = true;
-		}
-		else
-		{
-			for (unsigned int i = 0; i < list->size; i++)
-			{
-				count = 0;
-				const int temp = list->data[i];
-				for (unsigned int k = i; k < list->size; k++)
-				{
-					if (list->data[k] == temp) count++;
-				}
-				if (count > max_count)
-				{
-					max_count = count;
-					max = temp;
-				}
-			}
-		}
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", start_index,
+				list->size);
+		return -1;
 	}
 
-	if (sort)
+	if (!list_bloom_maybe_int(list, target))
 	{
-		for (unsigned int i = 1; i < list->size; i++)
-		{
-			if (sorted[i] == sorted[i - 1]) count++;
-			else count = 1;
-			if (count > max_count)
-			{
-				max_count = count;
-				max = sorted[i];
-			}
-		}
-	}
-
-	*return_val = max;
-	*return_amount = max_count;
+		*return_index = -1;
+		return 0;
+	}
 
-	if (mem_allocated)
+	unsigned int first;
+	const int indexed = list_index_find_int(list, target, &first);
+	if (indexed == 1 || (indexed == 0 && first >= start_index))
 	{
-		free(sorted);
-		sorted = NULL;
+		*return_index = indexed == 0 ? (long)first : -1;
+		return 0;
 	}
-	return 0;
-}
 
-int list_range_int(list_int *list, int *return_val)
-{
-	assert(list != NULL);
-	assert(list->data != NULL);
-	*return_val = 0;
-	int min = INT_MAX;
-	int max = INT_MIN;
-	for (unsigned int i = 0; i < list->size; i++)
+	if (list->sorted)
 	{
-		if (list->data[i] < min) min = list->data[i];
-		if (list->data[i] > max) max = list->data[i];
-		*return_val = max - min;
+		const unsigned int i = list_bound_int(list, start_index, target, false);
+		*return_index = i < list->size && *list_slot_int(list, i) == target ? (long)i : -1;
+		return 0;
 	}
+
+	const unsigned int i = list_find_int(list, start_index, target);
+	*return_index = i < list->size ? (long)i : -1;
 	return 0;
 }
 
 
-int list_append_int(list_int *list, int value)
+int list_count_int(list_int *list, int target, unsigned int *return_count)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
 
-	if (list->readonly)
+	if (!list_bloom_maybe_int(list, target))
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		*return_count = 0;
+		return 0;
 	}
 
-	if (list->static_)
+	if (list->sorted)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		const unsigned int lo = list_bound_int(list, 0, target, false);
+		*return_count = list_bound_int(list, lo, target, true) - lo;
+		return 0;
 	}
 
-	if (list->size >= list->capacity)
+	*return_count = 0;
+	for (unsigned int i = 0; i < list->size;)
 	{
-		if (list->frozen) return 0;
-		if (list->size == UINT_MAX)
-		{
-			fprintf(
-				stderr,
-				"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add: %u)",
-				UINT_MAX, list->capacity, 1);
-			return -2;
-		}
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list, list->capacity * 2);
-		if (state == -2)
-		{
-			fprintf(stderr, "Error: Value could not be added due to failed memory reallocation.\n");
-			return -2;
-		}
+		const int *run;
+		const unsigned int n = list_run_int(list, i, &run);
+		*return_count += list_kernels.count(run, n, target);
+		i += n;
 	}
-	list->data[list->size++] = value;
 	return 0;
 }
 
 
-int list_insert_int(list_int *list, unsigned int index, int value)
+int list_find_all_int(list_int *list, int target, list_int *out_indices)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	assert(out_indices != NULL);
+	assert(out_indices->data != NULL);
+	list_linearize_int(out_indices);
+	list_linearize_int(list);
 
-	if (index > list->size)
+	if (out_indices == list)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		fprintf(stderr, "Error: Attempt to write indices into the searched list.\n");
 		return -1;
 	}
 
-	if (list->readonly)
+	if (out_indices->readonly)
 	{
 		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
 		return -3;
 	}
 
-	if (list->static_)
+	if (out_indices->static_)
 	{
 		fprintf(stderr, "Error: Attempt to edit static list.\n");
 		return -3;
 	}
 
-	if (list->size >= list->capacity)
+	unsigned int start = 0;
+	unsigned int end = list_bloom_maybe_int(list, target) ? list->size : 0;
+	if (list->sorted && end > 0)
 	{
-		if (list->frozen) return 0;
-		if (list->size == UINT_MAX)
+		start = lower_bound_arr_int(list->data, 0, list->size, target);
+		end = upper_bound_arr_int(list->data, start, list->size, target);
+	}
+
+	list_notify_reset_int(out_indices);
+	out_indices->size = 0;
+
+	// hits go straight into out_indices, which only grows when a hit does not fit
+	unsigned int i = start;
+	while ((i = list_kernels.find_all(list->data, i, end, target, out_indices->data, &out_indices->size,
+									  out_indices->capacity)) < end)
+	{
+		if (out_indices->frozen) break;
+		if (out_indices->capacity == UINT_MAX)
 		{
-			fprintf(
-				stderr,
-				"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add: %u)",
-				UINT_MAX, list->capacity, 1);
+			fprintf(stderr, "Error: Max capacity of list cannot exceed %u.\n", UINT_MAX);
 			return -2;
 		}
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list, list->capacity * 2);
-		if (state == -2)
+
+		if (list_resize_int(out_indices, list_grow_capacity_int(out_indices, out_indices->capacity + 1)) != 0)
 		{
-			fprintf(stderr, "Error: Value could not be added due to failed memory reallocation.\n");
+			fprintf(stderr, "Error: Indices could not be added due to failed memory reallocation.\n");
 			return -2;
 		}
 	}
-	list->size++;
-	for (long i = list->size - 1; i >= index; i--)
-	{
-		list->data[i + 1] = list->data[i];
-	}
-	list->data[index] = value;
+
+	out_indices->sorted = true;
 	return 0;
 }
 
 
-int list_get_int(list_int *list, unsigned int index, int *value)
+int contains_merge_int(list_int *list, const int *targets, unsigned int k, long *out_indices)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (index >= list->size)
+	// sorted list: sort a copy of the targets and walk both once
+	int *sorted = malloc((size_t)k * sizeof(int));
+	long *found = malloc((size_t)k * sizeof(long));
+	if (sorted == NULL || found == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
-		return -1;
+		free(sorted);
+		free(found);
+		return -2;
 	}
-	*value = list->data[index];
-	return 0;
-}
-
-
-int list_set_int(list_int *list, unsigned int index, int value)
-{
-	assert(list != NULL);
-	assert(list->data != NULL);
 
-	if (index >= list->size)
+	memcpy(sorted, targets, (size_t)k * sizeof(int));
+	if (sort_arr_int(sorted, k) != 0)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
-		return -1;
+		free(sorted);
+		free(found);
+		return -2;
 	}
 
-	if (list->readonly)
+	unsigned int unique = 0;
+	unsigned int i = 0;
+	for (unsigned int j = 0; j < k; j++)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		if (unique > 0 && sorted[unique - 1] == sorted[j]) continue;
+		while (i < list->size && list->data[i] < sorted[j]) i++;
+		sorted[unique] = sorted[j];
+		found[unique++] = i < list->size && list->data[i] == sorted[j] ? (long)i : -1;
 	}
 
-	if (list->static_)
+	for (unsigned int j = 0; j < k; j++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		out_indices[j] = found[lower_bound_arr_int(sorted, 0, unique, targets[j])];
 	}
 
-	list->data[index] = value;
+	free(sorted);
+	free(found);
 	return 0;
 }
 
 
-int list_pop_back_int(list_int *list, int *return_val)
+int contains_hash_int(list_int *list, const int *targets, unsigned int k, long *out_indices)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-
-
-	if (list->size == 0)
+	// the table is built over the smaller side, values are first index + 1 so 0 means not seen
+	table_int table;
+	const bool over_targets = k <= list->size;
+	if (table_init_int(&table, over_targets ? k : list->size) != 0)
 	{
-		fprintf(stderr, "Error: Attempt to remove from 0 size list.\n");
-		return 0;
+		return -2;
 	}
 
-	if (list->readonly)
+	if (over_targets)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		for (unsigned int j = 0; j < k; j++)
+		{
+			bool inserted;
+			table_insert_int(&table, targets[j], &inserted);
+		}
+
+		unsigned int missing = table.count;
+		for (unsigned int i = 0; i < list->size && missing > 0; i++)
+		{
+			unsigned int *first = table_find_int(&table, list->data[i]);
+			if (first == NULL || *first != 0) continue;
+			*first = i + 1;
+			missing--;
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < list->size; i++)
+		{
+			bool inserted;
+			unsigned int *first = table_insert_int(&table, list->data[i], &inserted);
+			if (inserted) *first = i + 1;
+		}
 	}
 
-	if (list->static_)
+	for (unsigned int j = 0; j < k; j++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		const unsigned int *first = table_find_int(&table, targets[j]);
+		out_indices[j] = first != NULL && *first != 0 ? (long)*first - 1 : -1;
 	}
 
-	return list_take_int(list, list->size - 1, return_val);
+	table_free_int(&table);
+	return 0;
 }
 
-int list_remove_at_int(list_int *list, unsigned int index)
+
+int list_contains_many_int(list_int *list, const int *targets, unsigned int k, long *out_indices)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
 
-	if (index >= list->size)
+	if (targets == NULL || out_indices == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
+		fprintf(stderr, "Error: Attempt to search with NULL array.\n");
 		return -1;
 	}
 
-	if (list->readonly)
+	if (k <= LIST_CONTAINS_MANY_SCAN_MAX || list->hash_index != NULL || (list->sorted && k < list->size / 16))
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		// every target on its own is cheap: O(1) index lookups, binary searches, or a handful of vector scans
+		for (unsigned int j = 0; j < k; j++)
+		{
+			list_contains_int(list, targets[j], &out_indices[j], 0);
+		}
+		return 0;
 	}
 
-	if (list->static_)
+	list_linearize_int(list);
+	const int state = list->sorted ? contains_merge_int(list, targets, k, out_indices)
+								   : contains_hash_int(list, targets, k, out_indices);
+	if (state != 0)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		fprintf(stderr, "Error: Targets could not be searched due to failed memory allocation.\n");
 	}
+	return state;
+}
 
-	for (unsigned int i = index; i < list->size - 1; i++)
-	{
-		list->data[i] = list->data[i + 1];
-	}
 
-	list->size--;
+int list_lower_bound_int(list_int *list, int target, unsigned int *return_index)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
 
-	if (list->size < list->capacity / 4)
+	if (!list->sorted)
 	{
-		if (list->frozen) return 0;
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list, list->capacity / 2);
-		if (state == -2)
-		{
-			fprintf(stderr, "Error: Memory could not be reallocated.\n");
-			return -2;
-		}
+		fprintf(stderr, "Error: Attempt to binary search unsorted list.\n");
+		return -1;
 	}
+
+	*return_index = list_bound_int(list, 0, target, false);
 	return 0;
 }
 
 
-int list_remove_int(list_int *list, int value)
+int list_upper_bound_int(list_int *list, int target, unsigned int *return_index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
 
-	if (list->readonly)
-	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
-	}
-
-	if (list->static_)
+	if (!list->sorted)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		fprintf(stderr, "Error: Attempt to binary search unsorted list.\n");
+		return -1;
 	}
 
-	for (unsigned int i = 0; i < list->size; i++)
-	{
-		if (list->data[i] == value)
-		{
-			return list_remove_at_int(list, i);
-		}
-	}
-	return -1;
+	*return_index = list_bound_int(list, 0, target, true);
+	return 0;
 }
 
 
-int list_remove_all_int(list_int *list, int target)
+int list_insert_sorted_int(list_int *list, int value, unsigned int *return_index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
 
-	if (list->readonly)
+	if (!list->sorted)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		fprintf(stderr, "Error: Attempt to insert sorted into unsorted list.\n");
+		return -1;
 	}
 
-	if (list->static_)
+	const unsigned int index = list_bound_int(list, 0, value, true);
+	const int state = list_insert_int(list, index, value);
+	if (state == 0)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		*return_index = index;
 	}
+	return state;
+}
 
-	int memory_fail = 0;
-	int count = 0;
-	for (unsigned int i = 0; i < list->size;)
-	{
-		if (list->data[i] == target)
-		{
-			count++;
 
-			// ReSharper disable once CppLocalVariableMayBeConst
-			int state = list_remove_at_int(list, i);
-			if (state == -2)
-			{
-				fprintf(stderr, "Error: Memory reallocation failed.\n");
-				memory_fail = -2;
-			}
-			continue;
-		}
-		i++;
-	}
-	return count > 0 ? (memory_fail == -2 ? -2 : 0) : -1;
+void eytzinger_fill_int(list_eytzinger_int *index, const list_int *list, unsigned int *next, unsigned long long k) // NOLINT(*-no-recursion)
+{
+	// in-order walk of the implicit tree hands out the sorted values in order
+	if (k > index->size) return;
+	eytzinger_fill_int(index, list, next, 2 * k);
+	index->keys[k] = *list_slot_int(list, *next);
+	index->indices[k] = *next;
+	(*next)++;
+	eytzinger_fill_int(index, list, next, 2 * k + 1);
 }
 
 
-int list_remove_range_int(list_int *list, unsigned int start_index, unsigned int end_index)
+list_eytzinger_int *init_list_eytzinger_int(list_int *list)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
-	if (end_index >= list->size)
-	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", end_index, list->size);
-		return -1;
-	}
 
-	if (start_index >= end_index)
+	if (!list->sorted)
 	{
-		fprintf(stderr, "Error: start_index is greater than end_index");
-		return -1;
+		fprintf(stderr, "Error: Attempt to build a search index over an unsorted list.\n");
+		return NULL;
 	}
 
-	if (list->readonly)
+	if (!list->readonly && !list->static_)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		fprintf(stderr, "Error: Attempt to build a search index over a mutable list.\n");
+		return NULL;
 	}
 
-	if (list->static_)
+	list_eytzinger_int *index = malloc(sizeof(list_eytzinger_int));
+	if (index == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		fprintf(stderr, "Error: Memory allocation for index failed.\n");
+		return NULL;
 	}
 
-	const unsigned int diff = end_index - start_index;
-	for (unsigned int i = start_index; i < list->size - diff; i++)
+	// keys[0] is unused so the children of k are 2k and 2k + 1, lines of 16 keys start on a 64 byte boundary
+	const size_t bytes = ((size_t)list->size + 1) * sizeof(int);
+	index->keys = aligned_alloc(64, (bytes + 63) / 64 * 64);
+	index->indices = malloc(((size_t)list->size + 1) * sizeof(unsigned int));
+	if (index->keys == NULL || index->indices == NULL)
 	{
-		list->data[i] = list->data[i + diff];
+		free(index->keys);
+		free(index->indices);
+		free(index);
+		fprintf(stderr, "Error: Memory allocation for index->keys failed.\n");
+		return NULL;
 	}
+	index->size = list->size;
+
+	unsigned int next = 0;
+	eytzinger_fill_int(index, list, &next, 1);
+	return index;
+}
+
+
+int list_eytzinger_destroy_int(list_eytzinger_int **index)
+{
+	if (index == NULL) return 0;
+	if (*index == NULL) return 0;
+
+	free((*index)->keys);
+	free((*index)->indices);
+	free(*index);
+	*index = NULL;
+	return 0;
+}
 
-	list->size -= diff;
 
-	int ret_value = 0;
-	while (list->size < list->capacity / 4 && list->capacity / 2 > 1)
+unsigned long long eytzinger_search_int(const list_eytzinger_int *index, int target)
+{
+	// branchless descent, the keys 4 levels down (16 * k) share one cache line and are prefetched on the way
+	const int *keys = index->keys;
+	const unsigned long long size = index->size;
+	unsigned long long k = 1;
+	while (k <= size)
 	{
-		if (list->frozen) return 0;
-		if ((ret_value = list_resize_int(list, list->capacity / 2)) != 0) break;
+		__builtin_prefetch(keys + (16 * k <= size ? 16 * k : 0));
+		k = 2 * k + (keys[k] < target);
 	}
-	return ret_value;
+	// drop the trailing right turns and the final left turn, leaving the last node that was >= target (0 if none)
+	return k >> __builtin_ffsll((long long)~k);
 }
 
 
-int list_take_int(list_int *list, unsigned int index, int *value)
+int list_eytzinger_lower_bound_int(const list_eytzinger_int *index, int target, unsigned int *return_index)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (index >= list->size)
+	assert(index != NULL);
+
+	const unsigned long long k = eytzinger_search_int(index, target);
+	*return_index = k == 0 ? index->size : index->indices[k];
+	return 0;
+}
+
+
+int list_eytzinger_contains_int(const list_eytzinger_int *index, int target, long *return_index)
+{
+	assert(index != NULL);
+
+	const unsigned long long k = eytzinger_search_int(index, target);
+	*return_index = k != 0 && index->keys[k] == target ? (long)index->indices[k] : -1;
+	return 0;
+}
+
+
+int kmp_seq_int(const int *data, unsigned int start, unsigned int end, const int *seq, unsigned int seq_size,
+				unsigned int *found)
+{
+	unsigned int *fail = malloc(seq_size * sizeof(unsigned int));
+	if (fail == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index, list->size);
-		return -1;
+		return -2;
 	}
 
-	if (list->readonly)
+	// fail[j] = length of the longest proper border of seq[0..j]
+	fail[0] = 0;
+	for (unsigned int j = 1, k = 0; j < seq_size; j++)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		while (k > 0 && seq[j] != seq[k]) k = fail[k - 1];
+		if (seq[j] == seq[k]) k++;
+		fail[j] = k;
 	}
 
-	if (list->static_)
+	*found = end;
+	for (unsigned int i = start, k = 0; i < end; i++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		while (k > 0 && data[i] != seq[k]) k = fail[k - 1];
+		if (data[i] == seq[k]) k++;
+		if (k == seq_size)
+		{
+			*found = i + 1 - seq_size;
+			break;
+		}
 	}
 
-	*value = list->data[index];
-	return list_remove_at_int(list, index);
+	free(fail);
+	return 0;
 }
 
 
-int list_shrink_int(list_int *list)
+int horspool_seq_int(const int *data, unsigned int start, unsigned int end, const int *seq, unsigned int seq_size,
+					 unsigned int *found)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (list->frozen)
+	table_int shift;
+	if (table_init_int(&shift, seq_size) != 0)
 	{
-		fprintf(stderr, "Error: Attempt to resize frozen list.\n");
-		return -1;
+		return -2;
 	}
-	if (list->readonly)
+
+	// distance from the last occurrence of each value to the end of the sequence, the last value is left out
+	for (unsigned int j = 0; j + 1 < seq_size; j++)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		bool inserted;
+		*table_insert_int(&shift, seq[j], &inserted) = seq_size - 1 - j;
 	}
 
-	if (list->static_)
-	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+	const unsigned int last = end - seq_size + 1;
+	unsigned long long work = 0;
+	unsigned int i = start;
+	while (i < last)
+	{
+		unsigned int j = seq_size;
+		while (j > 0 && data[i + j - 1] == seq[j - 1]) j--;
+		if (j == 0)
+		{
+			table_free_int(&shift);
+			*found = i;
+			return 0;
+		}
+
+		work += seq_size - j + 1;
+		if (work > (unsigned long long)LIST_SEQ_WORK_FACTOR * (i - start + seq_size))
+		{
+			// periodic data keeps shifts short, finish in guaranteed linear time
+			table_free_int(&shift);
+			return kmp_seq_int(data, i + 1, end, seq, seq_size, found);
+		}
+
+		const unsigned int *distance = table_find_int(&shift, data[i + seq_size - 1]);
+		i += distance != NULL ? *distance : seq_size;
 	}
-	return list_resize_int(list, list->size);
+
+	table_free_int(&shift);
+	*found = end;
+	return 0;
 }
 
 
-int list_resize_int(list_int *list, unsigned int new_size)
+int find_seq_int(const int *data, unsigned int start, unsigned int end, const int *seq, unsigned int seq_size,
+				 unsigned int *found)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (list->frozen)
+	// expects 0 < seq_size <= end - start, *found is the first match in [start, end) or end
+	if (seq_size == 1)
 	{
-		fprintf(stderr, "Error: Attempt to resize a frozen list.\n");
+		*found = find_arr_int(data, start, end, seq[0]);
+		return 0;
 	}
 
-	if (list->readonly)
+	if (seq_size >= LIST_SEQ_HORSPOOL_THRESHOLD)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		return horspool_seq_int(data, start, end, seq, seq_size, found);
 	}
 
-	if (list->static_)
+	// short sequences, only starts matching both the first and the last value are compared in full
+	const unsigned int last = end - seq_size + 1;
+	unsigned long long work = 0;
+	unsigned int i = start;
+	while (i < last)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
-	}
-
-	const unsigned int true_size = new_size == 0 ? 1 : new_size;
-
-	int *new_data = realloc(list->data, sizeof(int) * true_size);
+		i = list_kernels.seq_filter(data, i, last, seq[0], seq[seq_size - 1], seq_size - 1);
+		if (i == last) break;
+		if (memcmp(data + i, seq, seq_size * sizeof(int)) == 0)
+		{
+			*found = i;
+			return 0;
+		}
 
-	if (new_data == NULL)
-	{
-		fprintf(stderr, "Error: Memory reallocation failed.\n");
-		return -2;
+		work += seq_size;
+		if (work > (unsigned long long)LIST_SEQ_WORK_FACTOR * (i - start + seq_size))
+		{
+			return kmp_seq_int(data, i + 1, end, seq, seq_size, found);
+		}
+		i++;
 	}
-	list->data = new_data;
-	list->capacity = true_size;
-	list->size = list->size >= new_size ? new_size : list->size;
+
+	*found = end;
 	return 0;
 }
 
 
-int list_to_arr_int(list_int *list, int **arr, unsigned int *size)
+int list_contains_seq_int(list_int *list, int *arr, unsigned int size, long *return_index, unsigned int start_index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
+
 	if (arr == NULL)
 	{
-		*size = 0;
-		fprintf(stderr, "Error: Attempt to assign values to NULL arr.\n");
+		fprintf(stderr, "Error: Attempt to compare NULL array.\n");
+		*return_index = -1;
 		return -1;
 	}
 
-	if (*arr != NULL)
+	if (size == 0)
 	{
-		fprintf(stderr, "Error: *arr is not NULL.\n");
-		*arr = NULL;
+		*return_index = -1;
+		return 0;
 	}
 
 	if (list->size == 0)
 	{
-		*size = 0;
+		*return_index = -1;
 		return 0;
 	}
 
-	*arr = malloc(sizeof(int) * list->size);
-	if (*arr == NULL)
+	if (start_index >= list->size)
 	{
-		fprintf(stderr, "Error: Memory allocation for arr failed.\n");
-		*size = 0;
-		return -2;
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", start_index,
+				list->size);
+		*return_index = -1;
+		return -1;
 	}
 
-	*size = list->size;
+	if (size > list->size - start_index)
+	{
+		*return_index = -1;
+		return 0;
+	}
 
-	for (unsigned int i = 0; i < list->size; i++)
+	unsigned int found;
+	if (find_seq_int(list->data, start_index, list->size, arr, size, &found) != 0)
 	{
-		(*arr)[i] = list->data[i];
+		fprintf(stderr, "Error: Sequence could not be searched due to failed memory allocation.\n");
+		*return_index = -1;
+		return -2;
 	}
+	*return_index = found < list->size ? (long)found : -1;
 
 	return 0;
 }
 
 
-int list_reset_int(list_int *list, int *arr, unsigned int size)
+int list_append_arr_int(list_int *list, int *arr, unsigned int size)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
 	if (arr == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to copy NULL array.\n");
+		fprintf(stderr, "Error: Attempt to append NULL array.\n");
 		return -1;
 	}
 
-	if (list->frozen && size != list->capacity)
+	if (UINT_MAX - list->size < size)
 	{
-		fprintf(stderr, "Error: Attempt to resize frozen list.\n");
-		return -3;
+		fprintf(
+			stderr,
+			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
+			UINT_MAX, list->capacity, size);
+		return -2;
 	}
 
 	if (list->readonly)
@@ -1104,49 +4615,36 @@ int list_reset_int(list_int *list, int *arr, unsigned int size)
 		return -3;
 	}
 
-	if (size == 0)
-	{
-		list_clear_int(list);
-		return 0;
-	}
-
-	int *new_data = realloc(list->data, sizeof(int) * size);
-	if (new_data == NULL)
-	{
-		fprintf(stderr, "Error: Memory reallocation failed.\n");
-		return -2;
-	}
-	list->data = new_data;
-	memcpy(list->data, arr, sizeof(int) * size);
-	list->size = size;
-	list->capacity = size;
-	return 0;
+	return list_splice_int(list, list->size, 0, arr, size);
 }
 
 
-int list_write_arr_int(list_int *list, int *arr, unsigned int size, unsigned int index)
+int list_splice_int(list_int *list, unsigned int start, unsigned int delete_count, const int *src,
+					unsigned int src_count)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
 
-	if (arr == NULL)
+	if (start > list->size || delete_count > list->size - start)
 	{
-		fprintf(stderr, "Error: Attempt to write NULL to list.\n");
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nRange [%u, %u)\nList bounds %u\n", start,
+				start + delete_count, list->size);
 		return -1;
 	}
 
-	if (index > list->size)
+	if (src == NULL && src_count > 0)
 	{
-		fprintf(stderr, "Error: Attempt to write out of list bounds.\n");
+		fprintf(stderr, "Error: Attempt to insert NULL array.\n");
 		return -1;
 	}
 
-	if (UINT_MAX - (list->size - index) <= size)
+	if (UINT_MAX - (list->size - delete_count) < src_count)
 	{
 		fprintf(
 			stderr,
-			"Error: Max capacity of list cannot exceed %u (current max capacity: %u, attempted number of values to add %u:)",
-			UINT_MAX, list->capacity, size);
+			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
+			UINT_MAX, list->capacity, src_count);
 		return -2;
 	}
 
@@ -1162,492 +4660,727 @@ int list_write_arr_int(list_int *list, int *arr, unsigned int size, unsigned int
 		return -3;
 	}
 
-	if (size == 0)
+	if (delete_count == 0 && src_count == 0)
 	{
 		return 0;
 	}
 
-	const unsigned int needed_mem = size + index;
-	unsigned int new_capacity = list->capacity;
-	if (needed_mem > list->capacity && !list->frozen)
+	int *copy = NULL;
+	if (src_count > 0 && (uintptr_t)src >= (uintptr_t)list->data &&
+		(uintptr_t)src < (uintptr_t)(list->data + list->capacity))
 	{
-		while (new_capacity <= needed_mem)
+		// src points into list->data, which is about to be moved (and maybe reallocated)
+		copy = malloc(sizeof(int) * src_count);
+		if (copy == NULL)
 		{
-			if (new_capacity > UINT_MAX / 2)
-			{
-				new_capacity = UINT_MAX;
-				break;
-			}
-			new_capacity *= 2;
+			fprintf(stderr, "Error: Memory allocation failed.\n");
+			return -2;
 		}
-		const int success = list_resize_int(list, new_capacity);
-		if (success == -2)
+		memcpy(copy, src, sizeof(int) * src_count);
+		src = copy;
+	}
+
+	const unsigned int new_size = list->size - delete_count + src_count;
+	if (new_size > list->capacity && !list->frozen)
+	{
+		if (list_resize_int(list, list_grow_capacity_int(list, new_size)) != 0)
 		{
-			fprintf(stderr, "Error: Memory reallocation failure.\n");
+			free(copy);
+			fprintf(stderr, "Error: Values could not be added due to failed memory reallocation.\n");
 			return -2;
 		}
 	}
 
-	for (unsigned int i = index; i < size + index && i < list->capacity; i++)
+	if (delete_count > 0)
 	{
-		list->data[i] = arr[i - index];
+		list_notify_remove_int(list, start, list->data + start, delete_count);
 	}
 
-	list->capacity = list->frozen ? list->capacity : new_capacity;
-	list->size = size + index > list->size ? (list->frozen ? list->capacity : size + index) : list->size;
+	// a frozen list keeps what fits in its capacity, losing the end of the tail first and then the end of src
+	const unsigned int capacity = list->capacity;
+	const unsigned int tail = list->size - start - delete_count;
+	const unsigned int moved = start + src_count >= capacity ? 0
+							   : tail < capacity - start - src_count ? tail
+							   : capacity - start - src_count;
+	const unsigned int copied = src_count < capacity - start ? src_count : capacity - start;
+	if (moved > 0)
+	{
+		memmove(list->data + start + src_count, list->data + start + delete_count, sizeof(int) * moved);
+	}
+	if (copied > 0)
+	{
+		memcpy(list->data + start, src, sizeof(int) * copied);
+	}
+	free(copy);
 
-	return 0;
+	list->size = new_size < capacity ? new_size : capacity;
+	if (moved < tail)
+	{
+		// values were pushed off the end of a frozen list
+		list_notify_reset_int(list);
+	}
+	else if (copied > 0)
+	{
+		list_notify_insert_int(list, start, list->data + start, copied);
+	}
+
+	return delete_count > src_count ? list_shrink_policy_int(list) : 0;
 }
 
 
-int list_contains_int(list_int *list, int target, long *return_index, unsigned int start_index)
+int list_insert_arr_int(list_int *list, int *arr, unsigned int size, unsigned int index)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
+	list_linearize_int(list);
 
-	if (list->size == 0)
+	if (index > list->size)
 	{
-		*return_index = -1;
-		return 0;
+		fprintf(stderr, "Error: Attempt to index out of bounds.\n start_index %u\nlist bounds %u", index,
+				list->size);
+		return -1;
 	}
 
-	if (start_index >= list->size)
+	if (arr == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", start_index,
-				list->size);
+		fprintf(stderr, "Error: Attempt to append NULL array.\n");
 		return -1;
 	}
 
-	for (unsigned int i = start_index; i < list->size; i++)
+	if (UINT_MAX - list->size <= size)
 	{
-		if (list->data[i] == target)
-		{
-			*return_index = i;
-			return 0;
-		}
+		fprintf(
+			stderr,
+			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
+			UINT_MAX, list->capacity, size);
+		return -2;
 	}
-	*return_index = -1;
-	return 0;
+
+	if (list->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	return list_splice_int(list, index, 0, arr, size);
 }
 
 
-int check_seq_int(int *arr, int *seq, unsigned int seq_size, unsigned int start_index)
+int list_append_list_int(list_int *list1, list_int *list2)
 {
-	for (unsigned int i = start_index; i < start_index + seq_size; i++)
+	assert(list1 != NULL);
+	assert(list1->data != NULL);
+	assert(list2 != NULL);
+	assert(list2->data != NULL);
+	list_linearize_int(list1);
+	list_linearize_int(list2);
+
+	if (UINT_MAX - list1->size < list2->size)
 	{
-		if (seq[i - seq_size] != arr[i]) return -1;
+		fprintf(
+			stderr,
+			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
+			UINT_MAX, list1->capacity, list2->size);
+		return -2;
 	}
-	return 0;
+
+	if (list1->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list1->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	return list_splice_int(list1, list1->size, 0, list2->data, list2->size);
 }
 
 
-int list_contains_seq_int(list_int *list, int *arr, unsigned int size, long *return_index, unsigned int start_index)
+int list_insert_list_int(list_int *list1, list_int *list2, unsigned int index)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
+	assert(list1 != NULL);
+	assert(list1->data != NULL);
+	assert(list2 != NULL);
+	assert(list2->data != NULL);
+	list_linearize_int(list1);
+	list_linearize_int(list2);
 
-	if (arr == NULL)
+	if (index > list1->size)
 	{
-		fprintf(stderr, "Error: Attempt to compare NULL array.\n");
-		*return_index = -1;
+		fprintf(stderr, "Error: Attempt to index out of bounds.\n start_index %u\nlist bounds %u", index,
+				list1->size);
 		return -1;
 	}
 
-	if (size == 0)
+	if (UINT_MAX - list1->size < list2->size)
+	{
+		fprintf(
+			stderr,
+			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
+			UINT_MAX, list1->capacity, list2->size);
+		return -2;
+	}
+
+	if (list2->size == 0)
 	{
-		*return_index = -1;
 		return 0;
 	}
 
-	if (list->size == 0)
+	if (list1->readonly)
+	{
+		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
+		return -3;
+	}
+
+	if (list1->static_)
+	{
+		fprintf(stderr, "Error: Attempt to edit static list.\n");
+		return -3;
+	}
+
+	return list_splice_int(list1, index, 0, list2->data, list2->size);
+}
+
+
+int list_contains_list_int(list_int *list1, list_int *list2, long *return_index, unsigned int index)
+{
+	assert(list1 != NULL);
+	assert(list1->data != NULL);
+	assert(list2 != NULL);
+	assert(list2->data != NULL);
+	list_linearize_int(list1);
+	list_linearize_int(list2);
+
+	if (index >= list1->size)
 	{
+		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index,
+				list1->size);
 		*return_index = -1;
-		return 0;
+		return -1;
 	}
 
-	if (start_index >= list->size)
+	if (list2->size > list1->size - index)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", start_index,
-				list->size);
 		*return_index = -1;
-		return -1;
+		return 0;
 	}
 
-	if (size > list->size - start_index)
+	if (list2->size == 0)
 	{
 		*return_index = -1;
 		return 0;
 	}
 
-	for (unsigned int i = start_index; i < list->size - size + 1; i++)
+	unsigned int found;
+	if (find_seq_int(list1->data, index, list1->size, list2->data, list2->size, &found) != 0)
 	{
-		if (list->data[i] == arr[0])
-		{
-			if (check_seq_int(list->data, arr, size, i) == 0)
-			{
-				*return_index = i;
-				return 0;
-			}
-		}
+		fprintf(stderr, "Error: Sequence could not be searched due to failed memory allocation.\n");
+		*return_index = -1;
+		return -2;
 	}
-	*return_index = -1;
+	*return_index = found < list1->size ? (long)found : -1;
 
 	return 0;
 }
 
 
-int list_append_arr_int(list_int *list, int *arr, unsigned int size)
+void *grow_arr_int(void *arr, unsigned int capacity, size_t element_size)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-	if (arr == NULL)
+	return realloc(arr, (size_t)capacity * element_size);
+}
+
+
+unsigned int edge_slot_int(const list_patterns_int *patterns, unsigned long long key)
+{
+	const unsigned int mask = patterns->edge_capacity - 1;
+	unsigned long long h = key * 0x9E3779B97F4A7C15ull;
+	h ^= h >> 29;
+	unsigned int slot = (unsigned int)(h >> 32) & mask;
+	while (patterns->edge_targets[slot] != 0 && patterns->edge_keys[slot] != key)
 	{
-		fprintf(stderr, "Error: Attempt to append NULL array.\n");
-		return -1;
+		slot = (slot + 1) & mask;
 	}
+	return slot;
+}
 
-	if (UINT_MAX - list->size < size)
+
+unsigned int edge_find_int(const list_patterns_int *patterns, unsigned int node, int value)
+{
+	// child of node along value, 0 if there is none
+	const unsigned long long key = (unsigned long long)node << 32 | (unsigned int)value;
+	return patterns->edge_targets[edge_slot_int(patterns, key)];
+}
+
+
+int edge_grow_int(list_patterns_int *patterns)
+{
+	const unsigned int old_capacity = patterns->edge_capacity;
+	unsigned long long *old_keys = patterns->edge_keys;
+	unsigned int *old_targets = patterns->edge_targets;
+	if (old_capacity > UINT_MAX / 2)
 	{
-		fprintf(
-			stderr,
-			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
-			UINT_MAX, list->capacity, size);
 		return -2;
 	}
 
-	if (list->readonly)
+	patterns->edge_keys = malloc((size_t)old_capacity * 2 * sizeof(unsigned long long));
+	patterns->edge_targets = calloc((size_t)old_capacity * 2, sizeof(unsigned int));
+	if (patterns->edge_keys == NULL || patterns->edge_targets == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		free(patterns->edge_keys);
+		free(patterns->edge_targets);
+		patterns->edge_keys = old_keys;
+		patterns->edge_targets = old_targets;
+		return -2;
 	}
+	patterns->edge_capacity = old_capacity * 2;
 
-	if (list->static_)
+	for (unsigned int i = 0; i < old_capacity; i++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		if (old_targets[i] == 0) continue;
+		const unsigned int slot = edge_slot_int(patterns, old_keys[i]);
+		patterns->edge_keys[slot] = old_keys[i];
+		patterns->edge_targets[slot] = old_targets[i];
 	}
+	free(old_keys);
+	free(old_targets);
+	return 0;
+}
 
-	if (size == 0)
+
+int patterns_reserve_int(list_patterns_int *patterns, unsigned int nodes)
+{
+	// room for nodes more trie nodes and their edges
+	if (nodes > UINT_MAX - patterns->node_count)
 	{
-		return 0;
+		return -2;
 	}
 
-
-	unsigned int orig_capacity = list->capacity;
-	while (list->size + size >= orig_capacity && !list->frozen)
+	unsigned int capacity = patterns->node_capacity == 0 ? 16 : patterns->node_capacity;
+	while (capacity < patterns->node_count + nodes)
 	{
-		if (orig_capacity >= UINT_MAX / 2)
-		{
-			orig_capacity = UINT_MAX;
-			break;
-		}
-		orig_capacity *= 2;
+		capacity = capacity >= UINT_MAX / 2 ? UINT_MAX : capacity * 2;
 	}
 
-	if (orig_capacity != list->capacity)
+	if (capacity != patterns->node_capacity)
 	{
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list, orig_capacity);
-		if (state == -2)
+		unsigned int **arrays[] = {&patterns->parent, &patterns->depth, &patterns->fail, &patterns->output,
+								   &patterns->dict};
+		for (unsigned int i = 0; i < sizeof(arrays) / sizeof(arrays[0]); i++)
 		{
-			fprintf(stderr, "Error: Values could not be added due to failed memory reallocation.\n");
-			return -2;
+			unsigned int *grown = grow_arr_int(*arrays[i], capacity, sizeof(unsigned int));
+			if (grown == NULL) return -2;
+			*arrays[i] = grown;
 		}
+		int *label = grow_arr_int(patterns->label, capacity, sizeof(int));
+		if (label == NULL) return -2;
+		patterns->label = label;
+		patterns->node_capacity = capacity;
 	}
-	for (unsigned int i = 0; i < size && i + list->size < list->capacity; i++)
+
+	while (patterns->edge_count + nodes > patterns->edge_capacity / 2)
 	{
-		list->data[i + list->size] = arr[i];
+		if (edge_grow_int(patterns) != 0) return -2;
 	}
-	list->size += list->frozen && list->size + size > list->capacity ? list->capacity - list->size : size;
 	return 0;
 }
 
 
-int list_insert_arr_int(list_int *list, int *arr, unsigned int size, unsigned int index)
+list_patterns_int *init_list_patterns_int(void)
 {
-	assert(list != NULL);
-	assert(list->data != NULL);
-
-	if (index > list->size)
+	list_patterns_int *patterns = calloc(1, sizeof(list_patterns_int));
+	if (patterns == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\n start_index %u\nlist bounds %u", index,
-				list->size);
-		return -1;
+		fprintf(stderr, "Error: Memory allocation for patterns failed.\n");
+		return NULL;
 	}
 
-	if (arr == NULL)
+	patterns->edge_capacity = 16;
+	patterns->edge_keys = malloc(16 * sizeof(unsigned long long));
+	patterns->edge_targets = calloc(16, sizeof(unsigned int));
+	if (patterns->edge_keys == NULL || patterns->edge_targets == NULL || patterns_reserve_int(patterns, 1) != 0)
 	{
-		fprintf(stderr, "Error: Attempt to append NULL array.\n");
-		return -1;
+		list_patterns_destroy_int(&patterns);
+		fprintf(stderr, "Error: Memory allocation for patterns failed.\n");
+		return NULL;
 	}
 
-	if (UINT_MAX - list->size <= size)
-	{
-		fprintf(
-			stderr,
-			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
-			UINT_MAX, list->capacity, size);
-		return -2;
-	}
+	patterns->parent[0] = 0;
+	patterns->label[0] = 0;
+	patterns->depth[0] = 0;
+	patterns->output[0] = UINT_MAX;
+	patterns->node_count = 1;
+	return patterns;
+}
 
-	if (list->readonly)
-	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
-	}
 
-	if (list->static_)
+int list_patterns_destroy_int(list_patterns_int **patterns)
+{
+	if (patterns == NULL) return 0;
+	if (*patterns == NULL) return 0;
+
+	free((*patterns)->parent);
+	free((*patterns)->label);
+	free((*patterns)->depth);
+	free((*patterns)->fail);
+	free((*patterns)->output);
+	free((*patterns)->dict);
+	free((*patterns)->edge_keys);
+	free((*patterns)->edge_targets);
+	free((*patterns)->pattern_sizes);
+	free((*patterns)->pattern_next);
+	free(*patterns);
+	*patterns = NULL;
+	return 0;
+}
+
+
+int list_patterns_add_arr_int(list_patterns_int *patterns, const int *arr, unsigned int size, unsigned int *return_id)
+{
+	assert(patterns != NULL);
+	if (arr == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		fprintf(stderr, "Error: Attempt to add NULL array.\n");
+		return -1;
 	}
 
 	if (size == 0)
 	{
-		return 0;
+		fprintf(stderr, "Error: Attempt to add an empty pattern.\n");
+		return -1;
 	}
 
-	unsigned int orig_capacity = list->capacity;
-	while (list->size + size >= orig_capacity && !list->frozen)
+	if (patterns->pattern_count == UINT_MAX - 1 || patterns_reserve_int(patterns, size) != 0)
 	{
-		if (orig_capacity >= UINT_MAX / 2)
-		{
-			orig_capacity = UINT_MAX;
-			break;
-		}
-		orig_capacity *= 2;
+		fprintf(stderr, "Error: Pattern could not be added due to failed memory reallocation.\n");
+		return -2;
 	}
 
-	if (orig_capacity != list->capacity)
+	if (patterns->pattern_count == patterns->pattern_capacity)
 	{
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list, orig_capacity);
-		if (state == -2)
+		const unsigned int capacity = patterns->pattern_capacity == 0 ? 16 :
+									  patterns->pattern_capacity >= UINT_MAX / 2 ? UINT_MAX - 1 :
+									  patterns->pattern_capacity * 2;
+		unsigned int *sizes = grow_arr_int(patterns->pattern_sizes, capacity, sizeof(unsigned int));
+		if (sizes != NULL) patterns->pattern_sizes = sizes;
+		unsigned int *next = grow_arr_int(patterns->pattern_next, capacity, sizeof(unsigned int));
+		if (next != NULL) patterns->pattern_next = next;
+		if (sizes == NULL || next == NULL)
 		{
-			fprintf(stderr, "Error: Values could not be added due to failed memory reallocation.\n");
+			fprintf(stderr, "Error: Pattern could not be added due to failed memory reallocation.\n");
 			return -2;
 		}
+		patterns->pattern_capacity = capacity;
 	}
 
-	for (long i = list->size - 1; i >= index; i--)
-	{
-		if (i + size > list->capacity) continue;
-		list->data[i + size] = list->data[i];
-	}
-
+	unsigned int node = 0;
 	for (unsigned int i = 0; i < size; i++)
 	{
-		if (i + index > list->capacity) continue;
-		list->data[index + i] = arr[i];
+		const unsigned long long key = (unsigned long long)node << 32 | (unsigned int)arr[i];
+		const unsigned int slot = edge_slot_int(patterns, key);
+		if (patterns->edge_targets[slot] == 0)
+		{
+			const unsigned int child = patterns->node_count++;
+			patterns->parent[child] = node;
+			patterns->label[child] = arr[i];
+			patterns->depth[child] = i + 1;
+			patterns->output[child] = UINT_MAX;
+			patterns->edge_keys[slot] = key;
+			patterns->edge_targets[slot] = child;
+			patterns->edge_count++;
+		}
+		node = patterns->edge_targets[slot];
 	}
-	list->size += list->frozen && list->size + size > list->capacity ? list->capacity - list->size : size;
 
+	// equal patterns share their end node and are chained
+	const unsigned int id = patterns->pattern_count++;
+	patterns->pattern_sizes[id] = size;
+	patterns->pattern_next[id] = patterns->output[node];
+	patterns->output[node] = id;
+	patterns->compiled = false;
+	*return_id = id;
 	return 0;
 }
 
 
-int list_append_list_int(list_int *list1, list_int *list2)
+int list_patterns_add_list_int(list_patterns_int *patterns, list_int *list, unsigned int *return_id)
 {
-	assert(list1 != NULL);
-	assert(list1->data != NULL);
-	assert(list2 != NULL);
-	assert(list2->data != NULL);
+	assert(list != NULL);
+	assert(list->data != NULL);
+	list_linearize_int(list);
+	return list_patterns_add_arr_int(patterns, list->data, list->size, return_id);
+}
 
-	if (UINT_MAX - list1->size < list2->size)
+
+int list_patterns_compile_int(list_patterns_int *patterns)
+{
+	assert(patterns != NULL);
+	if (patterns->compiled) return 0;
+
+	// fail links need the links of every shallower node, so nodes are visited by depth
+	unsigned int max_depth = 0;
+	for (unsigned int v = 0; v < patterns->node_count; v++)
 	{
-		fprintf(
-			stderr,
-			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
-			UINT_MAX, list1->capacity, list2->size);
-		return -2;
+		if (patterns->depth[v] > max_depth) max_depth = patterns->depth[v];
 	}
 
-	if (list1->readonly)
+	unsigned int *start = calloc((size_t)max_depth + 2, sizeof(unsigned int));
+	unsigned int *order = malloc((size_t)patterns->node_count * sizeof(unsigned int));
+	if (start == NULL || order == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
+		free(start);
+		free(order);
+		fprintf(stderr, "Error: Patterns could not be compiled due to failed memory allocation.\n");
+		return -2;
 	}
 
-	if (list1->static_)
+	for (unsigned int v = 0; v < patterns->node_count; v++)
 	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
+		start[patterns->depth[v] + 1]++;
 	}
-
-	if (list2->size == 0)
+	for (unsigned int d = 1; d <= max_depth + 1; d++)
 	{
-		return 0;
+		start[d] += start[d - 1];
 	}
-	unsigned int orig_capacity = list1->capacity;
-	while (list1->size + list2->size >= orig_capacity && !list1->frozen)
+	for (unsigned int v = 0; v < patterns->node_count; v++)
 	{
-		if (orig_capacity >= UINT_MAX / 2)
-		{
-			orig_capacity = UINT_MAX;
-			break;
-		}
-		orig_capacity *= 2;
+		order[start[patterns->depth[v]]++] = v;
 	}
 
-	if (orig_capacity != list1->capacity)
+	for (unsigned int i = 0; i < patterns->node_count; i++)
 	{
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list1, orig_capacity);
-		if (state == -2)
+		const unsigned int v = order[i];
+		const unsigned int p = patterns->parent[v];
+		unsigned int f = 0;
+		if (v != 0 && p != 0)
 		{
-			fprintf(stderr, "Error: Values could not be added due to failed memory reallocation.\n");
-			return -2;
+			f = patterns->fail[p];
+			unsigned int next;
+			while ((next = edge_find_int(patterns, f, patterns->label[v])) == 0 && f != 0)
+			{
+				f = patterns->fail[f];
+			}
+			f = next;
 		}
+		patterns->fail[v] = f;
+		patterns->dict[v] = v == 0 ? UINT_MAX : patterns->output[f] != UINT_MAX ? f : patterns->dict[f];
 	}
 
-	for (unsigned int i = 0; i < list2->size && i + list1->size < list1->capacity; i++)
-	{
-		list1->data[i + list1->size] = list2->data[i];
-	}
-	list1->size += list2->size + list1->size > list1->capacity && list1->frozen
-					   ? list1->capacity - list1->size
-					   : list2->size;
+	free(start);
+	free(order);
+	patterns->compiled = true;
 	return 0;
 }
 
 
-int list_insert_list_int(list_int *list1, list_int *list2, unsigned int index)
+int list_patterns_match_int(list_patterns_int *patterns, list_int *list,
+							int (*callback)(unsigned int pattern_id, unsigned int index, void *ctx), void *ctx)
 {
-	assert(list1 != NULL);
-	assert(list1->data != NULL);
-	assert(list2 != NULL);
-	assert(list2->data != NULL);
+	assert(patterns != NULL);
+	assert(list != NULL);
+	assert(list->data != NULL);
 
-	if (index > list1->size)
+	if (callback == NULL)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\n start_index %u\nlist bounds %u", index,
-				list1->size);
+		fprintf(stderr, "Error: Attempt to match with NULL callback.\n");
 		return -1;
 	}
 
-	if (UINT_MAX - list1->size < list2->size)
+	if (list_patterns_compile_int(patterns) != 0)
 	{
-		fprintf(
-			stderr,
-			"Error: Max capacity of list cannot exceed %u (current max capacity %u, attempted values to add %u values)",
-			UINT_MAX, list1->capacity, list2->size);
 		return -2;
 	}
 
-	if (list2->size == 0)
-	{
-		return 0;
-	}
-
-	if (list1->readonly)
+	unsigned int state = 0;
+	const int *run = list->data;
+	unsigned int run_start = 0, run_end = 0;
+	for (unsigned int i = 0; i < list->size; i++)
 	{
-		fprintf(stderr, "Error: Attempt to edit readonly list.\n");
-		return -3;
-	}
+		if (i == run_end)
+		{
+			// the automaton state carries over from one stored run to the next
+			run_start = i;
+			run_end = i + list_run_int(list, i, &run);
+		}
 
-	if (list1->static_)
-	{
-		fprintf(stderr, "Error: Attempt to edit static list.\n");
-		return -3;
-	}
+		unsigned int next;
+		while ((next = edge_find_int(patterns, state, run[i - run_start])) == 0 && state != 0)
+		{
+			state = patterns->fail[state];
+		}
+		state = next;
 
-	unsigned int orig_capacity = list1->capacity;
-	while (list1->size + list2->size >= orig_capacity && !list1->frozen)
-	{
-		if (orig_capacity >= UINT_MAX / 2)
+		// every pattern ending here hangs off state or a node on its dictionary chain
+		unsigned int node = patterns->output[state] != UINT_MAX ? state : patterns->dict[state];
+		for (; node != UINT_MAX; node = patterns->dict[node])
 		{
-			orig_capacity = UINT_MAX;
-			break;
+			for (unsigned int id = patterns->output[node]; id != UINT_MAX; id = patterns->pattern_next[id])
+			{
+				if (callback(id, i + 1 - patterns->pattern_sizes[id], ctx) != 0) return 0;
+			}
 		}
-		orig_capacity *= 2;
 	}
+	return 0;
+}
 
-	if (orig_capacity != list1->capacity)
+
+wide_int sum_scalar_int(const int *data, unsigned int size)
+{
+	// a long long holds 2^31 int values without overflowing, only the block sums need the wide type
+	wide_int sum = 0;
+	for (unsigned int start = 0; start < size;)
 	{
-		// ReSharper disable once CppLocalVariableMayBeConst
-		int state = list_resize_int(list1, orig_capacity);
-		if (state == -2)
+		const unsigned int end = size - start > 0x80000000u ? start + 0x80000000u : size;
+		long long block = 0;
+		for (unsigned int i = start; i < end; i++)
 		{
-			fprintf(stderr, "Error: Values could not be added due to failed memory reallocation.\n");
-			return -2;
+			block += data[i];
 		}
+		sum += block;
+		start = end;
 	}
+	return sum;
+}
 
 
-	for (long i = list1->size - 1; i >= index; i--)
-	{
-		if (i + list2->size > list1->capacity) continue;
-		list1->data[i + list2->size] = list1->data[i];
-	}
+#if LIST_X86_SIMD
+__attribute__((target("sse4.1")))
+wide_int sum_sse41_int(const int *data, unsigned int size)
+{
+	// int32 lanes are widened into int64 accumulators, one lane never exceeds 2^62
+	__m128i sum_low = _mm_setzero_si128();
+	__m128i sum_high = _mm_setzero_si128();
 
-	for (unsigned int i = 0; i < list2->size && i + index < list1->capacity; i++)
+	unsigned int i = 0;
+	for (; i + 4 <= size; i += 4)
 	{
-		list1->data[index + i] = list2->data[i];
+		const __m128i value = _mm_loadu_si128((const __m128i *)(data + i));
+		sum_low = _mm_add_epi64(sum_low, _mm_cvtepi32_epi64(value));
+		sum_high = _mm_add_epi64(sum_high, _mm_cvtepi32_epi64(_mm_srli_si128(value, 8)));
 	}
 
-	list1->size += list2->size + list1->size > list1->capacity && list1->frozen
-					   ? list1->capacity - list1->size
-					   : list2->size;
+	long long lanes[4];
+	_mm_storeu_si128((__m128i *)lanes, sum_low);
+	_mm_storeu_si128((__m128i *)(lanes + 2), sum_high);
 
-	return 0;
+	wide_int sum = sum_scalar_int(data + i, size - i);
+	for (unsigned int j = 0; j < 4; j++)
+	{
+		sum += lanes[j];
+	}
+	return sum;
 }
 
 
-int list_contains_list_int(list_int *list1, list_int *list2, long *return_index, unsigned int index)
+__attribute__((target("avx2")))
+wide_int sum_avx2_int(const int *data, unsigned int size)
 {
-	assert(list1 != NULL);
-	assert(list1->data != NULL);
-	assert(list2 != NULL);
-	assert(list2->data != NULL);
+	__m256i sum_low = _mm256_setzero_si256();
+	__m256i sum_high = _mm256_setzero_si256();
 
-	if (index >= list1->size)
+	unsigned int i = 0;
+	for (; i + 8 <= size; i += 8)
 	{
-		fprintf(stderr, "Error: Attempt to index out of bounds.\nIndex %u\nList bounds %u\n", index,
-				list1->size);
-		*return_index = -1;
-		return -1;
+		const __m256i value = _mm256_loadu_si256((const __m256i *)(data + i));
+		sum_low = _mm256_add_epi64(sum_low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value)));
+		sum_high = _mm256_add_epi64(sum_high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value, 1)));
 	}
 
-	if (list1->size < list2->size + index)
-	{
-		*return_index = -1;
-		return 0;
-	}
+	long long lanes[8];
+	_mm256_storeu_si256((__m256i *)lanes, sum_low);
+	_mm256_storeu_si256((__m256i *)(lanes + 4), sum_high);
 
-	if (list2->size == 0)
+	wide_int sum = sum_scalar_int(data + i, size - i);
+	for (unsigned int j = 0; j < 8; j++)
 	{
-		*return_index = -1;
-		return 0;
+		sum += lanes[j];
 	}
+	return sum;
+}
+#endif
 
-	for (unsigned int i = index; i < list1->size; i++)
-	{
-		if (list1->data[i] == list2->data[0])
-		{
-			if (check_seq_int(list1->data, list2->data, list2->size, i) == 0)
-			{
-				*return_index = i;
-				return 0;
-			}
-		}
-	}
-	*return_index = -1;
 
+int list_sum_int(list_int *list, long *value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	*value = (long)list_total_int(list);
 	return 0;
 }
 
 
-int list_sum_int(list_int *list, long *value)
+#ifdef __SIZEOF_INT128__
+int list_sum_int128_int(list_int *list, __int128 *value)
 {
 	assert(list != NULL);
 	assert(list->data != NULL);
 
-	*value = 0;
+	*value = list_sum_values_int(list);
+	return 0;
+}
+#endif
+
 
-	for (unsigned int i = 0; i < list->size; i++)
+typedef struct sum_task_int {
+	const int *data;
+	unsigned int size;
+	wide_int sum;
+} sum_task_int;
+
+
+void *sum_task_run_int(void *arg)
+{
+	sum_task_int *task = arg;
+	task->sum = sum_arr_int(task->data, task->size);
+	return NULL;
+}
+
+
+int list_sum_parallel_int(list_int *list, unsigned int nthreads, long *value)
+{
+	assert(list != NULL);
+	assert(list->data != NULL);
+
+	nthreads = list_thread_count_int(nthreads, list->size);
+	if (nthreads == 1 || list->cache != NULL || !list_contiguous_int(list))
+	{
+		return list_sum_int(list, value);
+	}
+
+	sum_task_int *tasks = malloc(nthreads * sizeof(sum_task_int));
+	if (tasks == NULL)
 	{
-		*value += (long) list->data[i];
+		fprintf(stderr, "Error: Memory allocation for sum tasks failed.\n");
+		return -2;
+	}
+
+	for (unsigned int i = 0; i < nthreads; i++)
+	{
+		const unsigned int start = (unsigned int)((unsigned long)list->size * i / nthreads);
+		const unsigned int end = (unsigned int)((unsigned long)list->size * (i + 1) / nthreads);
+		tasks[i].data = list->data + start;
+		tasks[i].size = end - start;
 	}
+	run_parallel_int(sum_task_run_int, tasks, sizeof(sum_task_int), nthreads);
+
+	wide_int sum = 0;
+	for (unsigned int i = 0; i < nthreads; i++)
+	{
+		sum += tasks[i].sum;
+	}
+	free(tasks);
+
+	*value = (long)sum;
 	return 0;
 }
 
@@ -1658,12 +5391,8 @@ int list_sum_list_int(list_int *list1, list_int *list2, long long *value)
 	assert(list1->data != NULL);
 	assert(list2 != NULL);
 	assert(list2->data != NULL);
-	long value1;
-	long value2;
 
-	list_sum_int(list1, &value1);
-	list_sum_int(list2, &value2);
-	*value = value1 + value2;
+	*value = (long long)(list_total_int(list1) + list_total_int(list2));
 	return 0;
 }
 
@@ -1674,7 +5403,7 @@ void list_print_int(list_int *list)
 	assert(list->data != NULL);
 	for (unsigned int i = 0; i < list->size; i++)
 	{
-		printf("%i | %i\n", i, list->data[i]);
+		printf("%i | %i\n", i, *list_slot_int(list, i));
 	}
 	printf("Size %u\nCapacity %u\n", list->size, list->capacity);
 }
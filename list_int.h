@@ -7,6 +7,27 @@
 #define DOUBLE_MIN DBL_MIN
 #define DOUBLE_MAX DBL_MAX
 
+typedef struct list_cache_int {
+	long long sum; /**< sum of every element */
+	int min; /**< smallest element */
+	int max; /**< largest element */
+	unsigned int min_index; /**< index of the first occurrence of min */
+	unsigned int max_index; /**< index of the first occurrence of max */
+	bool dirty; /**< min and max (and their indexes) need to be recomputed */
+	bool stale; /**< every aggregate needs to be recomputed */
+} list_cache_int;
+
+typedef struct list_policy_int {
+	double growth_factor; /**< capacity is multiplied by this whenever the list is full, greater than 1 */
+	unsigned int min_capacity; /**< capacity is never shrunk below this, and is reserved when the policy is set */
+	unsigned int shrink_divisor; /**< capacity is halved once size drops below capacity / shrink_divisor, at least 2 */
+	bool never_shrink; /**< if removals never reallocate, only list_shrink_int() and list_resize_int() shrink */
+} list_policy_int;
+
+typedef struct list_index_int list_index_int; /**< value -> first index hash table, private to list_int.c */
+typedef struct list_bloom_int list_bloom_int; /**< blocked Bloom filter over the values, private to list_int.c */
+typedef struct list_patterns_int list_patterns_int; /**< compiled set of sequences to search for, private to list_int.c */
+
 typedef struct list_int {
  bool frozen; /**< if the capacity of the array is allowed to change */
 	bool readonly; /**< if the data of the array is allowed to change */
@@ -14,8 +35,24 @@ typedef struct list_int {
 	unsigned int size; /**< Current number of elements */
 	unsigned int capacity; /**< Maximum number of elements before resizing */
 	int *data; /**< Pointer to the array of elements */
+	bool sorted; /**< if the data is known to be sorted from least to greatest, kept up to date by every function, writing to data directly requires list_mark_unsorted_int() */
+	list_cache_int *cache; /**< aggregate cache, nullptr unless enabled with list_enable_cache_int() */
+	list_index_int *hash_index; /**< membership index, nullptr unless enabled with list_enable_index_int() */
+	list_bloom_int *bloom; /**< negative lookup filter, nullptr unless enabled with list_enable_bloom_int() */
+	bool gap_buffer; /**< if inserts and removes move a gap to the edited index instead of shifting the tail */
+	unsigned int gap_start; /**< index of the first value behind the gap, only meaningful while gap_size is not 0 */
+	unsigned int gap_size; /**< unused slots of data in front of the value at gap_start, 0 while data is contiguous */
+	bool ring_buffer; /**< if both ends are edited in O(1) by wrapping around a power of 2 capacity */
+	unsigned int head; /**< slot of data holding the value at index 0, 0 while data is contiguous */
+	list_policy_int policy; /**< how capacity grows and shrinks, {2, 1, 4, false} unless set with list_set_policy_int() */
 } list_int;
 
+typedef struct list_eytzinger_int {
+	int *keys; /**< the values of a sorted list in Eytzinger (breadth first) order, 1 based */
+	unsigned int *indices; /**< index in the source list of each key */
+	unsigned int size; /**< Number of keys */
+} list_eytzinger_int;
+
 /**
  * A mutable list containing int
  *
@@ -215,6 +252,7 @@ void list_unfreeze_int(list_int *list);
  *
  * if a list_int is readonly, no modifications to the list are allowed and will return an error (-3)
  * the exception is list_destroy_int(), which will still destroy and free the list
+ * an open gap or a wrapped ring is linearized first, so reads never move the values of a readonly list
  *
  * Example:
  * @code
@@ -235,7 +273,7 @@ void list_unfreeze_int(list_int *list);
  *
  * @note complexity:
  * - best case: O(1)
- * - worst case: O(1)
+ * - worst case: O(n) if a gap is open or the ring wraps
  */
 void list_readonly_int(list_int *list);
 
@@ -263,6 +301,7 @@ void list_writable_int(list_int *list);
  *
  * if a list_int is static, no modifications to the list are allowed and will return an error (-3)
  * this also means that the list cannot be destroyed
+ * an open gap or a wrapped ring is linearized first, so reads never move the values of a static list
  *
  * Example:
  * @code
@@ -287,7 +326,7 @@ void list_writable_int(list_int *list);
  *
  * @note complexity:
  * - best case: O(1)
- * - worst case: O(1)
+ * - worst case: O(n) if a gap is open or the ring wraps
  *
  * @note carefully using this, while this may be usefully to ensure a list does not get destroyed when it doesn't need to in a sensitive codebase,
  * improper handling of this can result in careless memory leaks
@@ -315,6 +354,304 @@ void list_static_int(list_int *list);
  */
 void list_mutable_int(list_int *list);
 
+/**
+ * clears list->sorted after list->data was written to directly
+ *
+ * searches, counts, min/max, median and mode trust list->sorted to binary search or read the ends of the list,
+ * so a direct write that may break the order has to be followed by this call, or they silently return wrong answers
+ *
+ * Example:
+ * @code
+ * // my_list = {1, 2, 3}, my_list->sorted = true
+ * my_list->data[0] = 5;
+ * list_mark_unsorted_int(my_list);
+ * // my_list->sorted = false
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *
+ * @note list_sort_int() sets list->sorted again
+ */
+void list_mark_unsorted_int(list_int *list);
+
+
+/**
+ * attaches an aggregate cache to a list_int
+ *
+ * while the cache is enabled, mutators keep the sum, min and max of the list up to date, in O(1) where possible,
+ * so list_sum_int(), list_min_int(), list_max_int(), list_range_int() and list_minmax_int() usually answer in O(1)
+ * removing (or overwriting) the current min or max only marks them dirty, they are recomputed on the next query
+ *
+ * Example:
+ * @code
+ * list_enable_cache_int(my_list);
+ * list_append_int(my_list, 10);
+ * long sum;
+ * list_sum_int(my_list, &sum); // O(1)
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error
+ *  - Memory allocation for the cache failed
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *  - the aggregates are computed by the first query
+ *
+ * @note writing to list->data directly bypasses the cache, call list_disable_cache_int() and list_enable_cache_int() afterwards
+ */
+int list_enable_cache_int(list_int *list);
+
+/**
+ * detaches and frees the aggregate cache of a list_int
+ *
+ * Example:
+ * @code
+ * list_disable_cache_int(my_list);
+ * // my_list->cache = nullptr
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *
+ * @note see list_enable_cache_int() for list->cache documentation
+ */
+void list_disable_cache_int(list_int *list);
+
+
+/**
+ * attaches a hash index to a list_int, mapping each value to the index of its first occurrence
+ *
+ * while the index is enabled, mutators keep it up to date, so list_contains_int() and list_remove_int() find a value
+ * without scanning the list
+ * - inserts and removes at either end and overwrites are O(1) amortized
+ * - inserts and removes inside the list walk the stored indexes while the index has at most 4096 slots,
+ *   a larger index is marked stale
+ * - removing or overwriting the first occurrence of a value defers the search for its next occurrence
+ *   to the next lookup of that value, which scans the list in O(n)
+ * - removals of more than a few dozen values inside the list and reorders (sorting, reversing) mark the index stale
+ * a stale index is rebuilt in O(n) by the next lookup
+ *
+ * Example:
+ * @code
+ * list_enable_index_int(my_list);
+ * long index;
+ * list_contains_int(my_list, 10, &index, 0); // O(1)
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error
+ *  - Memory allocation for the index failed
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ *
+ * @note writing to list->data directly bypasses the index, call list_disable_index_int() and list_enable_index_int() afterwards
+ */
+int list_enable_index_int(list_int *list);
+
+/**
+ * detaches and frees the hash index of a list_int
+ *
+ * Example:
+ * @code
+ * list_disable_index_int(my_list);
+ * // my_list->hash_index = nullptr
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *
+ * @note see list_enable_index_int() for list->hash_index documentation
+ */
+void list_disable_index_int(list_int *list);
+
+
+/**
+ * attaches a blocked Bloom filter to a list_int, so lookups of values that are not in the list skip the search
+ *
+ * every value sets 8 bits inside one 64 byte block, so rejecting a value reads a single cache line
+ * list_contains_int(), list_count_int(), list_find_all_int(), list_remove_int() and list_remove_all_int() consult it
+ * inserts update the filter in place, removals leave their bits set and only make it less selective,
+ * after enough removals, a list_reset_int() or growth past its sizing the filter is rebuilt in O(n) by the next lookup
+ *
+ * Example:
+ * @code
+ * list_enable_bloom_int(my_list);
+ * long index;
+ * list_contains_int(my_list, 10, &index, 0); // O(1) if 10 is not in my_list (about 0.1% false positives)
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error
+ *  - Memory allocation for the filter failed
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ *
+ * @note writing to list->data directly bypasses the filter, call list_disable_bloom_int() and list_enable_bloom_int() afterwards
+ */
+int list_enable_bloom_int(list_int *list);
+
+/**
+ * detaches and frees the Bloom filter of a list_int
+ *
+ * Example:
+ * @code
+ * list_disable_bloom_int(my_list);
+ * // my_list->bloom = nullptr
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *
+ * @note see list_enable_bloom_int() for list->bloom documentation
+ */
+void list_disable_bloom_int(list_int *list);
+
+
+/**
+ * switches a list_int to gap buffer editing, leaving ring buffer mode if it was enabled
+ *
+ * the unused capacity is kept as a gap at the index of the last insert or remove,
+ * so list_insert_int(), list_remove_at_int() and list_take_int() only shift the values between the previous and
+ * the current edit, which is O(1) amortized for edits clustered around a moving cursor
+ * list_append_int() moves the gap to the end, list_get_int() and list_set_int() step over the gap,
+ * the sum, min / max, median, quantile, top k, count, contains, bound, histogram, print and pattern queries read both
+ * sides of the gap in place, the remaining functions (sort, mode, find all, sequence and batch searches, ...) call
+ * list_linearize_int() first
+ * list->hash_index follows the edits at either end, see list_enable_index_int() for edits inside the list
+ *
+ * Example:
+ * @code
+ * list_enable_gap_int(my_list);
+ * for (unsigned int i = 0; i < 1000; i++)
+ * {
+ *     list_insert_int(my_list, cursor++, i); // O(1) amortized
+ * }
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ *
+ * @note while a gap is open list->data is not contiguous, call list_linearize_int() before reading it directly
+ * @note reads are not thread-safe on a mutable gap list, the functions that call list_linearize_int() move the values,
+ * lock it with list_readonly_int() first to share it between threads
+ */
+void list_enable_gap_int(list_int *list);
+
+/**
+ * closes the gap and switches a list_int back to shifting the tail on every insert and remove
+ *
+ * Example:
+ * @code
+ * list_disable_gap_int(my_list);
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(n)
+ *
+ * @note see list_enable_gap_int() for list->gap_buffer documentation
+ */
+void list_disable_gap_int(list_int *list);
+
+/**
+ * switches a list_int to a ring buffer deque, leaving gap buffer editing if it was enabled
+ *
+ * the values wrap around a power of 2 capacity starting at list->head, so list_push_front_int(),
+ * list_pop_front_int(), list_append_int(), list_pop_back_int() and list_insert_int() / list_take_int() at either end
+ * are O(1) amortized, list_get_int() and list_set_int() stay O(1), the queries that read around a gap
+ * (see list_enable_gap_int()) read both runs of the ring in place, every other function calls list_linearize_int() first
+ * removing at either end never reallocates and ignores list->policy shrinking, call list_shrink_int() to release memory
+ *
+ * Example:
+ * @code
+ * list_enable_ring_int(queue);
+ * list_append_int(queue, job); // O(1) amortized
+ * list_pop_front_int(queue, &job); // O(1) amortized
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(n)
+ *
+ * @note while list->head is not 0 list->data is not contiguous, call list_linearize_int() before reading it directly
+ * @note with list->hash_index enabled edits at the front move one offset instead of the stored indexes
+ * @note reads are not thread-safe on a mutable ring list, the functions that call list_linearize_int() move the values,
+ * lock it with list_readonly_int() first to share it between threads
+ */
+void list_enable_ring_int(list_int *list);
+
+/**
+ * linearizes a list_int and switches it back from a ring buffer deque
+ *
+ * Example:
+ * @code
+ * list_disable_ring_int(queue);
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(n)
+ *
+ * @note see list_enable_ring_int() for list->ring_buffer documentation
+ */
+void list_disable_ring_int(list_int *list);
+
+/**
+ * moves the values of a list_int so list->data[0, list->size) holds them in order
+ * the list stays in its editing mode, the next edit reopens the gap or moves the head of the ring
+ * readonly and static lists are left untouched, list_readonly_int() and list_static_int() linearize them when locking
+ *
+ * Example:
+ * @code
+ * list_linearize_int(my_list);
+ * qsort(my_list->data, my_list->size, sizeof(int), compare);
+ * @endcode
+ *
+ * @param list a pointer to a list_int
+ *
+ * @note complexity:
+ * - best case: O(1) if the values are already contiguous
+ * - worst case: O(n)
+ */
+void list_linearize_int(list_int *list);
+
 
 /**
  * destroys a list_int, freeing memory and assigns list to nullptr
@@ -339,7 +676,8 @@ int list_destroy_int(list_int **list);
 
 
 /**
- * clears the data in a list and resizes it to 1
+ * clears the data in a list and resizes it to list->policy.min_capacity (1 by default), or keeps the capacity if
+ * list->policy.never_shrink is set
  *
  * Example:
  * @code
@@ -392,8 +730,41 @@ int list_clear_int(list_int *list);
 int list_reverse_int(list_int *list);
 
 
+/**
+ * counts how often every value in [lo, hi] occurs in a list_int, values outside of the range are ignored
+ *
+ * Example:
+ * @code
+ * // my_list = {3, 1, 3, 7, 2, 3}
+ * unsigned int counts[3];
+ * list_histogram_int(my_list, 1, 3, counts);
+ * // counts = {1, 1, 3}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param lo smallest value to count
+ * @param hi largest value to count, must be >= lo
+ * @param counts array of at least hi - lo + 1 unsigned int, counts[v - lo] is assigned the amount of v
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - counts = nullptr
+ *  - lo > hi
+ *  - [lo, hi] covers every int
+ *
+ * @note complexity:
+ * - best case: O(n + k)
+ * - worst case: O(n + k)
+ *  - k = hi - lo + 1
+ */
+int list_histogram_int(list_int *list, int lo, int hi, unsigned int *counts);
+
+
 /**
  * sorts list from least to greatest
+ * small lists are insertion/merge sorted, larger lists are counting sorted when max - min is small
+ * (checked on a sample first) and use a non-recursive LSD radix sort otherwise
  *
  * Example:
  * @code
@@ -406,17 +777,86 @@ int list_reverse_int(list_int *list);
  *
  * @return success state
 * - 0: Function executed successfully
+ * - -2: Memory error (no change occurs)
+ *  - Memory allocation for the radix sort buffer failed
  * - -3: List mutability error
  *  - list is readonly
  *  - list is static
  *
  * @note complexity:
- * - best case: O(n log n)
+ * - best case: O(1)
+ *  - list->sorted is already set
  * - worst case: O(n log n)
+ *  - list->size < 512, merge sort
+ *
+ * @note sets list->sorted, which lets searches and statistics take their O(log n) or O(1) paths
  */
 int list_sort_int(list_int *list);
 
 
+/**
+ * sorts list from least to greatest using multiple threads
+ * the list is split into one chunk per thread, every chunk is radix sorted concurrently,
+ * then the sorted chunks are merged pairwise with every merge split across the threads
+ *
+ * Example:
+ * @code
+ * // my_list = {3, 1, 5, 2, 4, ...}
+ * list_sort_parallel_int(my_list, 8);
+ * // my_list = {1, 2, 3, 4, 5, ...}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param nthreads the maximum number of threads to use, or 0 to use one per online cpu
+ *  - lists too small to be worth splitting are sorted on the calling thread with list_sort_int
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error (no change occurs)
+ *  - Memory allocation for the sort buffers failed
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(n / p + log p * n / p)
+ * - worst case: O(n / p + log p * n / p)
+ */
+int list_sort_parallel_int(list_int *list, unsigned int nthreads);
+
+
+/**
+ * finds the minimum and maximum values and the first occurrence of each in a single pass, or -1 indexes if list->size = 0
+ * uses AVX2 or SSE4.1 when the cpu supports them
+ *
+ * Example:
+ * @code
+ * int min, max;
+ * long min_index, max_index;
+ * // my_list = {2, 6, 2, 4, 7, 7, 2}
+ * list_minmax_int(my_list, &min, &min_index, &max, &max_index);
+ * // min = 2, min_index = 0
+ * // max = 7, max_index = 4
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param min_val address for the minimum value
+ * @param min_index address for the index of the first minimum
+ * @param max_val address for the maximum value
+ * @param max_index address for the index of the first maximum
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - list->size = 0
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+int list_minmax_int(list_int *list, int *min_val, long *min_index, int *max_val, long *max_index);
+
+
 /**
  * finds the maximum value and the first occurrence of it in a list_int, or -1 index if list->size = 0
  *
@@ -476,14 +916,15 @@ int list_min_int(list_int *list, int *return_val, long *return_index);
 
 /**
  * finds the median value in a list_int, or 0 if list->size = 0
- * sorts list if not already sorted
+ * the list is not modified, the selection runs on a scratch copy, so readonly and static lists are allowed
  *
  * Example:
  * @code
- * // my_list = {1, 2, 3, 4, 5, 10}
+ * // my_list = {10, 2, 5, 4, 3, 1}
  * float val;
  * list_median_int(my_list, &val);
  * // val = 3.5
+ * // my_list = {10, 2, 5, 4, 3, 1}
  * @endcode
  *
  * @params list pointer to a list_int
@@ -491,50 +932,148 @@ int list_min_int(list_int *list, int *return_val, long *return_index);
  *
  * @return success state
  * - 0: Function executed successfully
- * - -3: List mutability error
- *  - list is readonly
- *  - list is static
+ * - -2: Memory error
+ *  - Memory allocation for the scratch copy failed
  *
  * @note complexity:
- * - best case: O(n log n)
- *  - if list is sorted
- * - worst case: O(n^2)
- *  - if list is not sorted
+ * - best case: O(n)
+ * - worst case: O(n)
+ *  - quickselect falls back to median of medians pivots
  */
 int list_median_int(list_int *list, float *return_val);
 
 /**
- * finds the median of a list_int
+ * finds the median value in a list_int, or 0 if list->size = 0, using a caller supplied buffer instead of allocating
+ * the list is not modified, readonly and static lists are allowed
+ *
+ * Example:
+ * @code
+ * // my_list = {10, 2, 5, 4, 3, 1}
+ * int buffer[6];
+ * float val;
+ * list_median_buf_int(my_list, buffer, &val);
+ * // val = 3.5
+ * // buffer contents are unspecified
+ * @endcode
+ *
+ * @params list pointer to a list_int
+ * @params buffer scratch space of at least list->size int, overwritten
+ * @params return_val address for the returned value
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - buffer = nullptr
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+int list_median_buf_int(list_int *list, int *buffer, float *return_val);
+
+/**
+ * finds several order statistics of a list_int at once, without sorting or modifying the list
+ * quantile q maps to the value at rank round(q * (list->size - 1)) of the sorted list
+ *
+ * Example:
+ * @code
+ * // my_list = {0, 1, 2, ..., 999} in any order
+ * double qs[4] = {0.5, 0.9, 0.99, 0.999};
+ * int out[4];
+ * list_quantiles_int(my_list, qs, 4, out);
+ * // out = {500, 899, 989, 998}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param qs array of quantiles in [0, 1], in any order
+ * @param n size of qs
+ * @param out array of at least n int, out[i] is assigned the qs[i] quantile
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - qs = nullptr
+ *  - out = nullptr
+ *  - list->size = 0
+ *  - a quantile is outside of [0, 1]
+ * - -2: Memory error
+ *  - Memory allocation for the scratch copy failed
+ *
+ * @note complexity:
+ * - best case: O(n)
+ *  - O(k) if list->sorted is set
+ * - worst case: O(n log k)
+ *  - k is the amount of distinct ranks requested
+ */
+int list_quantiles_int(list_int *list, const double *qs, unsigned int n, int *out);
+
+/**
+ * finds the mode of a list_int, ties go to the smallest value
  *
  * Example:
  * @code
- * // my_list = {1, 2, 3, 4, 5, 10}
- * list_mode_int(my_list, &val, &amount, true);
+ * // my_list = {5, 2, 3, 2, 5, 10}
+ * list_mode_int(my_list, &val, &amount, false);
  * // val = 2
- * // amount = 1
+ * // amount = 2
  * @endcode
  *
  * @param list pointer to a list_int
  * @param return_val address for the returned value
  * @param return_amount address for the amount of the mode
- * @param sort if the list should be sorted before finding the mode, if false, attempts to create a sorted copy, if memory allocation fails, uses a less efficient method
+ * @param sort if the list should be sorted before finding the mode, if false (or the list cannot be sorted),
+ * the values are counted in a hash table and the list is not modified, if that allocation fails, uses a less efficient method
  *
  * @return success state
  * - 0: Function executed successfully
  * - -1: Parameter error
- * - -2: Memory error
- * - -3: List mutability error
- *  - list is readonly
- *  - list is static
+ *  - list->size = 0
  *
  * @note complexity:
- * - best case: O(n log n)
- *  - if list is sorted
+ * - best case: O(n)
+ *  - sort = false, hash table counting
  * - worst case: O(n^2)
- *  - if list is not sorted and fails to make a sorted copy
+ *  - if the hash table cannot be allocated
  */
 int list_mode_int(list_int *list, int *return_val, unsigned int *return_amount, bool sort);
 
+/**
+ * finds the k most frequent values of a list_int in a single pass without modifying the list
+ * results are ordered from most to least frequent, ties go to the smallest value
+ *
+ * Example:
+ * @code
+ * // my_list = {5, 2, 3, 2, 5, 10, 5}
+ * int values[2];
+ * unsigned int counts[2];
+ * unsigned int found;
+ * list_top_k_frequent_int(my_list, 2, values, counts, &found);
+ * // values = {5, 2}
+ * // counts = {3, 2}
+ * // found = 2
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param k the maximum amount of values to return
+ * @param values array of at least k int for the returned values
+ * @param counts array of at least k unsigned int for the amount of each returned value
+ * @param return_k address for the amount of values returned, min(k, distinct values in list)
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - values = nullptr
+ *  - counts = nullptr
+ * - -2: Memory error
+ *  - Memory allocation for the frequency table failed
+ *
+ * @note complexity:
+ * - best case: O(n + d log k)
+ * - worst case: O(n + d log k)
+ *  - d is the amount of distinct values
+ */
+int list_top_k_frequent_int(list_int *list, unsigned int k, int *values, unsigned int *counts, unsigned int *return_k);
+
 /**
  * finds the range of a list_int
  *
@@ -547,11 +1086,13 @@ int list_mode_int(list_int *list, int *return_val, unsigned int *return_amount,
  * @endcode
  *
  * @param list pointer to a list_int
- * @param return_val address for the returned value
+ * @param return_val address for the returned value, 0 for an empty list
  *
  *
  * @return success state
  * - 0: Function executed successfully
+ * - -1: Range error (*return_val = 0)
+ *  - max - min is greater than INT_MAX, e.g. a list holding both INT_MIN and INT_MAX
  *
  * @note complexity:
  * - best case: O(n)
@@ -715,9 +1256,64 @@ int list_set_int(list_int *list, unsigned int index, int value);
 int list_pop_back_int(list_int *list, int *return_val);
 
 
+/**
+ * Inserts a value at the front of a list.
+ *
+ * Example:
+ * @code
+ * // my_list = {1, 2, 3}
+ * list_push_front_int(my_list, 0);
+ * // my_list = {0, 1, 2, 3}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param value the value to insert
+ *
+ * @return success state
+ * - see list_insert_int()
+ *
+ * @note complexity:
+ * - best case: O(1) amortized if list->ring_buffer is set
+ * - worst case: O(n)
+ */
+int list_push_front_int(list_int *list, int value);
+
+
+/**
+ * Removes and returns the first value of a list.
+ *
+ * Example:
+ * @code
+ * int value;
+ * // my_list = {1, 2, 3}
+ * list_pop_front_int(my_list, &value);
+ * // my_list = {2, 3}
+ * // value = 1
+ * @endcode
+ *
+ * @param list pointer to a list_int, list must contain >= 1 elements
+ * @param return_val address for the return value to be assigned to
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - list->size = 0
+ * - -2: Memory error (value is removed)
+ *  - Failed memory reallocation
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(1) amortized if list->ring_buffer is set
+ * - worst case: O(n)
+ */
+int list_pop_front_int(list_int *list, int *return_val);
+
+
 /**
  * Removes the value at the specified index, shifts the values at the right of the index
- * Resizes list if size < capacity / 4.
+ * Resizes list if size < capacity / list->policy.shrink_divisor.
  *
  * Example:
  * @code
@@ -747,6 +1343,35 @@ int list_pop_back_int(list_int *list, int *return_val);
 int list_remove_at_int(list_int *list, unsigned int index);
 
 
+/**
+ * Removes the value at the specified index by moving the last value into its place, for lists where order does not
+ * matter. The capacity is never shrunk, call list_shrink_int() to release memory.
+ *
+ * Example:
+ * @code
+ * // my_list = {1, 2, 3, 4, 5}
+ * list_swap_remove_int(my_list, 1);
+ * // my_list = {1, 5, 3, 4}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param index index to be removed
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - Index out of bounds
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1), O(n) once to close an open gap if list->gap_buffer is enabled
+ */
+int list_swap_remove_int(list_int *list, unsigned int index);
+
+
 /**
  * Removes the first instance of value.
  *
@@ -790,19 +1415,124 @@ int list_remove_int(list_int *list, int value);
  *
  * @return success state
  * - 0: Function executed successfully
+ * - -1: target is not in the list
  * - -2: Memory error (values are removed)
 *  - Memory reallocation failure
  * - -3: List mutability error
  *  - list is readonly
  *  - list is static
  *
+ * @note the list is compacted in a single pass (8 values per step with AVX2) and shrunk at most once
+ *
  * @note complexity:
  * - best case: O(n)
- * - worst case: O(n^2)
+ * - worst case: O(n)
  */
 int list_remove_all_int(list_int *list, int target);
 
 
+/**
+ * Removes every instance of target by moving values from the end of the list into the holes, for lists where order
+ * does not matter. Only one value is written per removed value, and the capacity is never shrunk, call
+ * list_shrink_int() to release memory.
+ *
+ * Example:
+ * @code
+ * // my_list = {10, 2, 10, 8, 7, 6}
+ * list_remove_all_unordered_int(my_list, 10);
+ * // my_list = {6, 2, 7, 8}
+ * @endcode
+ *
+ * @param list pointer to list_int
+ * @param target value to remove
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: target is not in the list
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+int list_remove_all_unordered_int(list_int *list, int target);
+
+
+/**
+ * Removes every value predicate returns true for, the remaining values keep their order.
+ *
+ * Example:
+ * @code
+ * bool is_negative(int value, void *ctx)
+ * {
+ *     return value < 0;
+ * }
+ * // my_list = {1, -2, 10, -8, 10, 7}
+ * list_remove_if_int(my_list, is_negative, NULL);
+ * // my_list = {1, 10, 10, 7}
+ * @endcode
+ *
+ * @param list pointer to list_int
+ * @param predicate called once for every value, in order
+ * @param ctx passed through to predicate
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - predicate = nullptr
+ * - -2: Memory error (values are removed)
+*  - Memory reallocation failure
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note the list is compacted in a single pass and shrunk at most once
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+int list_remove_if_int(list_int *list, bool (*predicate)(int value, void *ctx), void *ctx);
+
+
+/**
+ * Removes the values at every index in indices, which may be unsorted and contain duplicates.
+ *
+ * Example:
+ * @code
+ * unsigned int drop[4] = {4, 0, 2, 4};
+ * // my_list = {1, 2, 10, 8, 10, 7}
+ * list_remove_indices_int(my_list, drop, 4);
+ * // my_list = {2, 8, 7}
+ * @endcode
+ *
+ * @param list pointer to list_int
+ * @param indices pointer to the array of indices to remove
+ * @param k the size of indices
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error (no values removed)
+ *  - indices = nullptr
+ *  - Index out of bounds
+ * - -2: Memory error
+ *  - Memory allocation failure (no values removed)
+ *  - Memory reallocation failure (values are removed)
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note the remaining values are moved once and the list is shrunk at most once
+ *
+ * @note complexity:
+ * - best case: O(n + k)
+ * - worst case: O(n + k)
+ */
+int list_remove_indices_int(list_int *list, const unsigned int *indices, unsigned int k);
+
+
 /**
  * Removes the values in the index range (start_index, end_index].
  *
@@ -869,7 +1599,7 @@ int list_take_int(list_int *list, unsigned int index, int *value);
 
 
 /**
- * Resizes the list to the number of elements it contains.
+ * Resizes the list to the number of elements it contains, or to list->policy.min_capacity if that is larger.
  *
  * Example:
  * @code
@@ -929,6 +1659,44 @@ int list_shrink_int(list_int *list);
 int list_resize_int(list_int *list, unsigned int new_size);
 
 
+/**
+ * Sets how the capacity of the list grows and shrinks, every function that adds or removes values follows it.
+ * Reserving the largest expected size as min_capacity with never_shrink set keeps every later edit from reallocating.
+ *
+ * Example:
+ * @code
+ * list_policy_int policy = {1.5, 4096, 8, false};
+ * list_set_policy_int(my_list, &policy);
+ * // my_list->capacity >= 4096
+ * // grows by 1.5x, and halves only once my_list->size < my_list->capacity / 8
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param policy the policy to copy into list->policy, cannot be nullptr
+ *  - policy->growth_factor must be greater than 1
+ *  - policy->shrink_divisor must be at least 2
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error (no change occurs)
+ *  - policy is nullptr
+ *  - policy->growth_factor is not greater than 1
+ *  - policy->shrink_divisor is less than 2
+ * - -2: Memory error
+ *  - Failed memory reallocation while reserving policy->min_capacity, the policy is still set
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(n)
+ *
+ * @note a frozen list takes the policy without reserving policy->min_capacity
+ */
+int list_set_policy_int(list_int *list, const list_policy_int *policy);
+
+
 /**
  * Assigns an array containing the values of the list, note that the array is allocated memory for the values.
  *
@@ -972,6 +1740,8 @@ int list_to_arr_int(list_int *list, int **arr, unsigned int *size);
  * // my_list = {1, 2, 3}
  * @endcode
  *
+ * the buffer is reused if it holds size values, otherwise it grows, and it shrinks afterwards, as list->policy allows
+ *
  * @param list pointer to list_int
  * @param arr array to move into list->data, cannot be nullptr
  * @param size size of the array, must be > 0 to prevent undefined behavior for memory allocation
@@ -980,7 +1750,7 @@ int list_to_arr_int(list_int *list, int **arr, unsigned int *size);
  * - 0: Function executed successfully
  * - -1: Parameter error
  *  - arr = nullptr
- * - -2: Memory error (no change occurs)
+ * - -2: Memory error (no change occurs if growing failed)
  *  - Failed memory reallocation
 *
  * - -3: List mutability error
@@ -1054,62 +1824,365 @@ int list_write_arr_int(list_int *list, int *arr, unsigned int size, unsigned int
  * @note complexity:
  * - best case: O(1)
  * - worst case: O(n)
+ *  - O(log n) if list->sorted is set
+ *  - O(1) if list->hash_index is enabled and start_index is at or before the first instance
+ *
+ * @note the linear search compares 4, 8 or 16 values per instruction (SSE2, AVX2 or AVX-512),
+ * picked once at load time from what the cpu supports
  */
 int list_contains_int(list_int *list, int target, long *return_index, unsigned int start_index);
 
 
 /**
- * Finds a specified sequence in a list and returns that index, or -1 if sequence not found.
+ * Counts the instances of target value in a list.
  *
  * Example:
  * @code
- * int arr[3] = {1, 2, 3};
- * long index;
- * // my_list = {5, 6, 1, 7, 1, 2, 3, 8}
- * list_contains_seq_int(my_list, arr, 3, &index, 0);
- * // index = 4
+ * unsigned int count;
+ * // my_list = {1, 7, 3, 7, 8, 7}
+ * list_count_int(my_list, 7, &count);
+ * // count = 3
  * @endcode
  *
  * @param list pointer to a list_int
- * @param arr pointer to int array
- * @param size the size of arr
- * @param return_index the address of the return value
- * @param start_index the index to start search at
+ * @param target the int to count
+ * @param return_count address for the return value
  *
  * @return success state
  * - 0: Function executed successfully
- * - -1: Parameter error
- *  - Index out of bounds
- *  - arr = nullptr
  *
  * @note complexity:
- * - best case: O(m)
- * - worst case: O((n - m) * m)
+ * - best case: O(log n) if list->sorted is set
+ * - worst case: O(n)
  */
-int list_contains_seq_int(list_int *list, int *arr, unsigned int size, long *return_index, unsigned int start_index);
+int list_count_int(list_int *list, int target, unsigned int *return_count);
 
 
 /**
- * Appends a pointer array to a list.
+ * Replaces the contents of out_indices with the indices of every instance of target value, in ascending order.
+ * The list is scanned once, and out_indices only grows when its capacity is reached, so reusing the same
+ * out_indices for repeated queries does not reallocate.
  *
  * Example:
  * @code
- * int arr[3] = {1, 2, 3};
- * // my_list = {1, 2, 3, 4, 5}
- * list_append_arr_int(my_list, arr, 3);
- * // my_list = {1, 2, 3, 4, 5, 1, 2, 3}
+ * list_int *indices = init_list_int(16);
+ * // my_list = {1, 7, 3, 7, 8, 7}
+ * list_find_all_int(my_list, 7, indices);
+ * // indices = {1, 3, 5}
  * @endcode
  *
  * @param list pointer to a list_int
- * @param arr array, must be greater than 0
- * @param size size of arr
+ * @param target the int you are trying to find
+ * @param out_indices pointer to a list_int the indices are written to
  *
  * @return success state
  * - 0: Function executed successfully
  * - -1: Parameter error
- *  - arr = nullptr
- * - -2: Memory error (values not added)
- *  - list->capacity + added data would exceed uint limit
+ *  - out_indices = list
+ * - -2: Memory error (out_indices holds the indices found so far)
+ *  - out_indices would exceed uint limit
+ *  - Failed memory reallocation
+ * - -3: List mutability error
+ *  - out_indices is readonly
+ *  - out_indices is static
+ *
+ * @note if out_indices is frozen only the first out_indices->capacity indices are written
+ * @note indices are stored as int, so lists past INT_MAX elements wrap
+ *
+ * @note complexity:
+ * - best case: O(log n + k) if list->sorted is set
+ * - worst case: O(n)
+ */
+int list_find_all_int(list_int *list, int target, list_int *out_indices);
+
+
+/**
+ * Finds the index of the first instance of every target value, or -1 for targets not in the list.
+ * Large batches are answered in one pass, with a hash table over the smaller of list and targets,
+ * or by merging with the sorted targets if list->sorted is set. The list is not changed.
+ *
+ * Example:
+ * @code
+ * int targets[3] = {10, 4, 7};
+ * long indices[3];
+ * // my_list = {1, 7, 3, 10, 8, 7}
+ * list_contains_many_int(my_list, targets, 3, indices);
+ * // indices = {3, -1, 1}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param targets pointer to the int array of values to find
+ * @param k the size of targets
+ * @param out_indices pointer to a long array of size k for the indices
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - targets = nullptr
+ *  - out_indices = nullptr
+ * - -2: Memory error (out_indices not written)
+ *  - Failed memory allocation
+ *
+ * @note complexity:
+ * - best case: O(k) if list->hash_index is enabled
+ * - worst case: O(n + k) expected
+ *  - O(k log n) or O(n + k log k) if list->sorted is set
+ */
+int list_contains_many_int(list_int *list, const int *targets, unsigned int k, long *out_indices);
+
+
+/**
+ * Finds the first index whose value is not less than target, or list->size if there is none.
+ *
+ * Example:
+ * @code
+ * unsigned int index;
+ * // my_list = {1, 3, 3, 5, 8}
+ * list_lower_bound_int(my_list, 3, &index);
+ * // index = 1
+ * list_lower_bound_int(my_list, 4, &index);
+ * // index = 3
+ * @endcode
+ *
+ * @param list pointer to a sorted list_int
+ * @param target the value to search for
+ * @param return_index address for the return value
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - list->sorted is not set
+ *
+ * @note complexity:
+ * - best case: O(log n)
+ * - worst case: O(log n)
+ */
+int list_lower_bound_int(list_int *list, int target, unsigned int *return_index);
+
+
+/**
+ * Finds the first index whose value is greater than target, or list->size if there is none.
+ *
+ * Example:
+ * @code
+ * unsigned int index;
+ * // my_list = {1, 3, 3, 5, 8}
+ * list_upper_bound_int(my_list, 3, &index);
+ * // index = 3
+ * @endcode
+ *
+ * @param list pointer to a sorted list_int
+ * @param target the value to search for
+ * @param return_index address for the return value
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - list->sorted is not set
+ *
+ * @note complexity:
+ * - best case: O(log n)
+ * - worst case: O(log n)
+ */
+int list_upper_bound_int(list_int *list, int target, unsigned int *return_index);
+
+
+/**
+ * Inserts a value into a sorted list, after any values equal to it, keeping the list sorted.
+ *
+ * Example:
+ * @code
+ * unsigned int index;
+ * // my_list = {1, 3, 5, 8}
+ * list_insert_sorted_int(my_list, 4, &index);
+ * // my_list = {1, 3, 4, 5, 8}
+ * // index = 2
+ * @endcode
+ *
+ * @param list pointer to a sorted list_int
+ * @param value the value to insert
+ * @param return_index address for the index the value was inserted at
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - list->sorted is not set
+ * - -2: Memory error (value not added)
+ *  - Failed memory reallocation in function list_insert_int
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(log n)
+ * - worst case: O(n)
+ */
+int list_insert_sorted_int(list_int *list, int value, unsigned int *return_index);
+
+
+/**
+ * builds a read only search index over a sorted list that is readonly or static
+ * the values are copied in Eytzinger (breadth first) order, so the first levels of every search share a few
+ * cache lines, and deeper levels are prefetched while the search descends
+ *
+ * Example:
+ * @code
+ * list_sort_int(my_list);
+ * list_readonly_int(my_list);
+ * list_eytzinger_int *index = init_list_eytzinger_int(my_list);
+ * long found;
+ * list_eytzinger_contains_int(index, 10, &found);
+ * list_eytzinger_destroy_int(&index);
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ *
+ * @return success state:
+ * - pointer to list_eytzinger_int: successfully created the index
+ * - nullptr: Parameter error
+ *  - list->sorted is not set
+ *  - list is neither readonly nor static
+ * - nullptr: Memory error
+ *  - Allocation for the index failed
+ *
+ * @note the index is a snapshot, it is not updated if the list is made writable and edited afterwards
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+list_eytzinger_int *init_list_eytzinger_int(list_int *list);
+
+
+/**
+ * destroys a list_eytzinger_int, freeing memory and assigns index to nullptr
+ *
+ * Example:
+ * @code
+ * list_eytzinger_destroy_int(&index);
+ * @endcode
+ *
+ * @param index address to the pointer of a list_eytzinger_int
+ *
+ * @return success state:
+ * - 0: destroyed index
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ */
+int list_eytzinger_destroy_int(list_eytzinger_int **index);
+
+
+/**
+ * Finds the index in the source list of the first value that is not less than target, like list_lower_bound_int
+ *
+ * Example:
+ * @code
+ * unsigned int i;
+ * // source list = {1, 3, 3, 7}
+ * list_eytzinger_lower_bound_int(index, 3, &i);
+ * // i = 1
+ * list_eytzinger_lower_bound_int(index, 8, &i);
+ * // i = 4
+ * @endcode
+ *
+ * @param index pointer to a list_eytzinger_int
+ * @param target the int to search for
+ * @param return_index address for the return value, index->size if every value is less than target
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ *
+ * @note complexity:
+ * - best case: O(log n)
+ * - worst case: O(log n)
+ */
+int list_eytzinger_lower_bound_int(const list_eytzinger_int *index, int target, unsigned int *return_index);
+
+
+/**
+ * Finds the index in the source list of the first instance of target value, or -1 if it is not in the list
+ *
+ * Example:
+ * @code
+ * long i;
+ * // source list = {1, 3, 3, 7}
+ * list_eytzinger_contains_int(index, 3, &i);
+ * // i = 1
+ * @endcode
+ *
+ * @param index pointer to a list_eytzinger_int
+ * @param target the int you are trying to find
+ * @param return_index address for the return value
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ *
+ * @note complexity:
+ * - best case: O(log n)
+ * - worst case: O(log n)
+ */
+int list_eytzinger_contains_int(const list_eytzinger_int *index, int target, long *return_index);
+
+
+/**
+ * Finds a specified sequence in a list and returns that index, or -1 if sequence not found.
+ *
+ * Example:
+ * @code
+ * int arr[3] = {1, 2, 3};
+ * long index;
+ * // my_list = {5, 6, 1, 7, 1, 2, 3, 8}
+ * list_contains_seq_int(my_list, arr, 3, &index, 0);
+ * // index = 4
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param arr pointer to int array
+ * @param size the size of arr
+ * @param return_index the address of the return value
+ * @param start_index the index to start search at
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - Index out of bounds
+ *  - arr = nullptr
+ * - -2: Memory error (nothing searched)
+ *  - Failed memory allocation of the search tables
+ *
+ * @note complexity:
+ * - best case: O(m)
+ * - worst case: O(n + m)
+ *
+ * @note short sequences are found by filtering on their first and last values, long ones with
+ * Boyer-Moore-Horspool; both switch to KMP when repetitive data makes them do too many compares
+ */
+int list_contains_seq_int(list_int *list, int *arr, unsigned int size, long *return_index, unsigned int start_index);
+
+
+/**
+ * Appends a pointer array to a list.
+ *
+ * Example:
+ * @code
+ * int arr[3] = {1, 2, 3};
+ * // my_list = {1, 2, 3, 4, 5}
+ * list_append_arr_int(my_list, arr, 3);
+ * // my_list = {1, 2, 3, 4, 5, 1, 2, 3}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param arr array, must be greater than 0
+ * @param size size of arr
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - arr = nullptr
+ * - -2: Memory error (values not added)
+ *  - list->capacity + added data would exceed uint limit
 *  - Failed memory reallocation
  * - -3: List mutability error
  *  - list is readonly
@@ -1157,6 +2230,46 @@ int list_append_arr_int(list_int *list, int *arr, unsigned int size);
 int list_insert_arr_int(list_int *list, int *arr, unsigned int size, unsigned int index);
 
 
+/**
+ * Replaces delete_count values starting at start with the src_count values of src, growing the list at most once.
+ * every bulk insert and remove is built on it: the tail is moved with a single memmove and src is copied with memcpy
+ *
+ * Example:
+ * @code
+ * int arr[3] = {7, 8, 9};
+ * // my_list = {1, 2, 3, 4, 5}
+ * list_splice_int(my_list, 1, 2, arr, 3);
+ * // my_list = {1, 7, 8, 9, 4, 5}
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param start index of the first value to replace, can be list->size
+ * @param delete_count number of values to remove from start on
+ * @param src values to insert at start, may point into list->data, can be nullptr if src_count = 0
+ * @param src_count number of values in src
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error (no change occurs)
+ *  - start or start + delete_count out of bounds
+ *  - src = nullptr while src_count > 0
+ * - -2: Memory error (no change occurs)
+ *  - list->size + added data would exceed uint limit
+ *  - Failed memory reallocation
+ * - -3: List mutability error
+ *  - list is readonly
+ *  - list is static
+ *
+ * @note complexity:
+ * - best case: O(m) amortized
+ * - worst case: O(n + m) amortized
+ *
+ * @note if list is frozen the values that no longer fit in list->capacity are lost
+ */
+int list_splice_int(list_int *list, unsigned int start, unsigned int delete_count, const int *src,
+					unsigned int src_count);
+
+
 /**
  * Appends the data of list2 onto list1.
  *
@@ -1246,20 +2359,181 @@ int list_insert_list_int(list_int *list1, list_int *list2, unsigned int index);
  * - 0: Function executed successfully
  * - -1: Parameter error
  *  - Index out of bounds
- * - -2: Memory error (values not added)
- *  - list1->capacity + added data would exceed uint limit
-*  - Failed memory reallocation
- * - -3: List mutability error
- *  - list is readonly
- *  - list is static
+ * - -2: Memory error (nothing searched)
+ *  - Failed memory allocation of the search tables
  *
  * @note complexity:
  * - best case: O(m)
- * - worst case: O((n - m) * m)
+ * - worst case: O(n + m)
+ *
+ * @note shares the search of list_contains_seq_int
  */
 int list_contains_list_int(list_int *list1, list_int *list2, long *return_index, unsigned int index);
 
 
+/**
+ * creates an empty set of sequences that is searched for in a single pass over a list (Aho-Corasick)
+ * the set does not reference any list and can be matched against as many lists as needed
+ *
+ * Example:
+ * @code
+ * list_patterns_int *patterns = init_list_patterns_int();
+ * int a[2] = {1, 2};
+ * int b[3] = {2, 3, 4};
+ * unsigned int id;
+ * list_patterns_add_arr_int(patterns, a, 2, &id); // id = 0
+ * list_patterns_add_arr_int(patterns, b, 3, &id); // id = 1
+ * list_patterns_compile_int(patterns);
+ * @endcode
+ *
+ * @return success state:
+ * - pointer to list_patterns_int: successfully created the set
+ * - nullptr: Memory error
+ *  - Allocation for the set failed
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ */
+list_patterns_int *init_list_patterns_int(void);
+
+
+/**
+ * destroys a list_patterns_int, freeing memory and assigns patterns to nullptr
+ *
+ * Example:
+ * @code
+ * list_patterns_destroy_int(&patterns);
+ * @endcode
+ *
+ * @param patterns address to the pointer of a list_patterns_int
+ *
+ * @return success state:
+ * - 0: destroyed set
+ *
+ * @note complexity:
+ * - best case: O(1)
+ * - worst case: O(1)
+ */
+int list_patterns_destroy_int(list_patterns_int **patterns);
+
+
+/**
+ * Adds a sequence to a pattern set, ids are handed out in order starting at 0
+ *
+ * Example:
+ * @code
+ * int arr[3] = {1, 2, 3};
+ * unsigned int id;
+ * list_patterns_add_arr_int(patterns, arr, 3, &id);
+ * @endcode
+ *
+ * @param patterns pointer to a list_patterns_int
+ * @param arr pointer to int array
+ * @param size the size of arr
+ * @param return_id address for the id of the pattern
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - arr = nullptr
+ *  - size = 0
+ * - -2: Memory error (pattern not added)
+ *  - Failed memory reallocation
+ *
+ * @note adding to a compiled set makes the next match compile it again
+ *
+ * @note complexity:
+ * - best case: O(m) amortized
+ * - worst case: O(m) amortized
+ */
+int list_patterns_add_arr_int(list_patterns_int *patterns, const int *arr, unsigned int size, unsigned int *return_id);
+
+
+/**
+ * Adds the values of a list as a sequence to a pattern set
+ *
+ * Example:
+ * @code
+ * unsigned int id;
+ * list_patterns_add_list_int(patterns, my_list, &id);
+ * @endcode
+ *
+ * @param patterns pointer to a list_patterns_int
+ * @param list pointer to a list_int, the values are copied
+ * @param return_id address for the id of the pattern
+ *
+ * @return success state
+ * - see list_patterns_add_arr_int()
+ *
+ * @note complexity:
+ * - best case: O(m) amortized
+ * - worst case: O(m) amortized
+ */
+int list_patterns_add_list_int(list_patterns_int *patterns, list_int *list, unsigned int *return_id);
+
+
+/**
+ * Builds the failure links of a pattern set, done by list_patterns_match_int() if needed
+ *
+ * Example:
+ * @code
+ * list_patterns_compile_int(patterns);
+ * @endcode
+ *
+ * @param patterns pointer to a list_patterns_int
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error
+ *  - Failed memory allocation
+ *
+ * @note complexity:
+ * - best case: O(M), M the total size of the patterns
+ * - worst case: O(M)
+ */
+int list_patterns_compile_int(list_patterns_int *patterns);
+
+
+/**
+ * Reports every occurrence of every pattern of a set in a list, in a single pass over the list
+ * matches are reported in order of the index they end at, callback returns non-zero to stop the search
+ *
+ * Example:
+ * @code
+ * int print_match(unsigned int pattern_id, unsigned int index, void *ctx)
+ * {
+ *     printf("pattern %u at %u\n", pattern_id, index);
+ *     return 0;
+ * }
+ * // patterns = {{1, 2}, {2, 3, 4}}
+ * // my_list = {1, 2, 3, 4, 1, 2}
+ * list_patterns_match_int(patterns, my_list, print_match, NULL);
+ * // pattern 0 at 0
+ * // pattern 1 at 1
+ * // pattern 0 at 4
+ * @endcode
+ *
+ * @param patterns pointer to a list_patterns_int
+ * @param list pointer to a list_int
+ * @param callback called with the id of the pattern and the index its match starts at
+ * @param ctx passed through to callback
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -1: Parameter error
+ *  - callback = nullptr
+ * - -2: Memory error (nothing searched)
+ *  - Failed memory allocation compiling the set
+ *
+ * @note complexity:
+ * - best case: O(n + z), z the number of matches
+ * - worst case: O(n + z)
+ */
+int list_patterns_match_int(list_patterns_int *patterns, list_int *list,
+							int (*callback)(unsigned int pattern_id, unsigned int index, void *ctx), void *ctx);
+
+
 /**
  * Gets the sum of every value in a list.
  *
@@ -1279,10 +2553,63 @@ int list_contains_list_int(list_int *list1, list_int *list2, long *return_index,
  * @note complexity:
  * - best case: O(n)
  * - worst case: O(n)
+ *
+ * @note values are accumulated in vectorized 64 bit lanes, the result is truncated if it does not fit in a long,
+ * see list_sum_int128_int() for an overflow safe result
  */
 int list_sum_int(list_int *list, long *value);
 
 
+#ifdef __SIZEOF_INT128__
+/**
+ * Gets the sum of every value in a list as a 128 bit integer, which cannot overflow for any list_int.
+ *
+ * Example:
+ * @code
+ * __int128 sum;
+ * list_sum_int128_int(my_list, &sum);
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param value address of an __int128 to assign the value to
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ *
+ * @note complexity:
+ * - best case: O(n)
+ * - worst case: O(n)
+ */
+int list_sum_int128_int(list_int *list, __int128 *value);
+#endif
+
+
+/**
+ * Gets the sum of every value in a list, splitting the list across multiple threads.
+ *
+ * Example:
+ * @code
+ * long sum;
+ * list_sum_parallel_int(my_list, 8, &sum);
+ * @endcode
+ *
+ * @param list pointer to a list_int
+ * @param nthreads the maximum number of threads to use, or 0 to use one per online cpu
+ *  - lists too small to be worth splitting are summed on the calling thread
+ * @param value address of a long to assign the value to
+ *
+ * @return success state
+ * - 0: Function executed successfully
+ * - -2: Memory error
+ *  - Memory allocation for the thread tasks failed
+ *
+ * @note complexity:
+ * - best case: O(n / p)
+ * - worst case: O(n / p)
+ */
+int list_sum_parallel_int(list_int *list, unsigned int nthreads, long *value);
+
+
 /**
  * Gets the sum of every value in two lists.
  *